@@ -586,6 +586,12 @@ SOURCES += \
     ../../src/burn/vector.cpp \
     ../../src/burn/burn_sound_c.cpp \
     ../../src/burn/burn_memory.cpp \
+    ../../src/burn/burn_cache.cpp \
+    ../../src/burn/burn_idle.cpp \
+    ../../src/burn/burn_sched.cpp \
+    ../../src/burn/burn_resample.cpp \
+    ../../src/burn/burn_profile.cpp \
+    ../../src/burn/burn_threads.cpp \
     ../../src/burn/burn_led.cpp \
     ../../src/burn/burn_gun.cpp \
     ../../src/cpu/hd6309_intf.cpp \
@@ -789,6 +795,12 @@ HEADERS += \
     ../../src/burn/snd/ymf278b.h \
     ../../src/burn/snd/ymz280b.h \
     ../../src/burn/snd/pokey.h \
+    ../../src/burn/burn_cache.h \
+    ../../src/burn/burn_idle.h \
+    ../../src/burn/burn_sched.h \
+    ../../src/burn/burn_resample.h \
+    ../../src/burn/burn_profile.h \
+    ../../src/burn/burn_threads.h \
     ../../src/burn/burn_sound.h \
     ../../src/burn/burn.h \
     ../../src/burn/burnint.h \
@@ -862,6 +874,7 @@ HEADERS += \
     ../../src/intf/interface.h \
     ../../src/intf/audio/aud_dsp.h \
     ../../src/intf/audio/lowpass2.h \
+    ../../src/intf/audio/ringbuffer.h \
     ../../src/intf/cd/cd_interface.h \
     ../../src/intf/input/inp_keys.h \
     ../../src/intf/video/vid_support.h \
@@ -926,7 +939,9 @@ $$DRC_MIPS3_X64 {
         message("MIPS3 x64 dynarec enabled")
         DEFINES += \
             XBYAK_NO_OP_NAMES \
-            MIPS3_X64_DRC
+            MIPS3_X64_DRC \
+            SH2_X64_DRC \
+            ARM7_X64_DRC
 
         HEADERS += \
             ../../src/cpu/mips3/x64/mips3_x64.h \
@@ -942,7 +957,9 @@ $$DRC_MIPS3_X64 {
             ../../src/cpu/mips3/x64/xbyak/xbyak.h \
             ../../src/cpu/mips3/x64/xbyak/xbyak_bin2hex.h \
             ../../src/cpu/mips3/x64/xbyak/xbyak_mnemonic.h \
-            ../../src/cpu/mips3/x64/xbyak/xbyak_util.h
+            ../../src/cpu/mips3/x64/xbyak/xbyak_util.h \
+            ../../src/cpu/sh2/sh2_x64.h \
+            ../../src/cpu/arm7/arm7_x64.h
 
         SOURCES += \
             ../../src/cpu/mips3/x64/mips3_x64.cpp
@@ -952,7 +969,6 @@ $$DRC_MIPS3_X64 {
 #-------------------------------------------------------------------------------
 # Linux only drivers
 #-------------------------------------------------------------------------------
-linux: HEADERS += ../../src/intf/audio/linux/ringbuffer.h
 linux: SOURCES += ../../src/intf/audio/linux/aud_pulse_simple.cpp
 
 OTHER_FILES +=
@@ -980,6 +980,12 @@ SOURCES += \
     ../../src/burn/vector.cpp \
     ../../src/burn/burn_sound_c.cpp \
     ../../src/burn/burn_memory.cpp \
+    ../../src/burn/burn_cache.cpp \
+    ../../src/burn/burn_idle.cpp \
+    ../../src/burn/burn_sched.cpp \
+    ../../src/burn/burn_resample.cpp \
+    ../../src/burn/burn_profile.cpp \
+    ../../src/burn/burn_threads.cpp \
     ../../src/burn/burn_led.cpp \
     ../../src/burn/burn_gun.cpp \
     ../../src/cpu/hd6309_intf.cpp \
@@ -1043,6 +1049,8 @@ SOURCES += \
     ../../src/burner/sshot.cpp \
     ../../src/burner/state.cpp \
     ../../src/burner/statec.cpp \
+    ../../src/burner/rewind.cpp \
+    ../../src/burner/runahead.cpp \
     ../../src/burner/zipfn.cpp \
     ../../src/burner/ioapi.c \
     ../../src/burner/unzip.c \
@@ -1052,6 +1060,9 @@ SOURCES += \
     ../../src/burner/sdl/inpdipsw.cpp \
     ../../src/burner/sdl/main.cpp \
     ../../src/burner/sdl/run.cpp \
+    ../../src/intf/perfcount/prf_interface.cpp \
+    ../../src/intf/perfcount/prf_zones.cpp \
+    ../../src/intf/perfcount/sdl/prf_steady_clock.cpp \
     ../../src/burner/sdl/stated.cpp \
     ../../src/burner/sdl/stringset.cpp \
     ../../src/dep/libs/libpng/png.c \
@@ -1165,6 +1176,12 @@ HEADERS += \
     ../../src/burn/snd/ymdeltat.h \
     ../../src/burn/snd/ymf278b.h \
     ../../src/burn/snd/ymz280b.h \
+    ../../src/burn/burn_cache.h \
+    ../../src/burn/burn_idle.h \
+    ../../src/burn/burn_sched.h \
+    ../../src/burn/burn_resample.h \
+    ../../src/burn/burn_profile.h \
+    ../../src/burn/burn_threads.h \
     ../../src/burn/burn_sound.h \
     ../../src/burn/burn.h \
     ../../src/burn/burnint.h \
@@ -1251,6 +1268,7 @@ HEADERS += \
     ../../src/intf/interface.h \
     ../../src/intf/audio/aud_dsp.h \
     ../../src/intf/audio/lowpass2.h \
+    ../../src/intf/audio/ringbuffer.h \
     ../../src/intf/cd/cd_interface.h \
     ../../src/intf/input/inp_keys.h \
     ../../src/intf/input/sdl/inp_sdl_keys.h \
@@ -79,11 +79,27 @@ bool BurnCheckMMXSupport()
 #endif
 }
 
+// Driver numbers sorted by zip name, so drivers can be looked up by name without going through the whole list
+static UINT32* pBurnDrvNameIndex = NULL;
+
+static int __cdecl BurnDrvNameIndexCompare(const void* a, const void* b)
+{
+	return strcmp(pDriver[*(const UINT32*)a]->szShortName, pDriver[*(const UINT32*)b]->szShortName);
+}
+
 extern "C" INT32 BurnLibInit()
 {
 	BurnLibExit();
 	nBurnDrvCount = sizeof(pDriver) / sizeof(pDriver[0]);	// count available drivers
 
+	pBurnDrvNameIndex = (UINT32*)malloc(nBurnDrvCount * sizeof(UINT32));
+	if (pBurnDrvNameIndex) {
+		for (UINT32 i = 0; i < nBurnDrvCount; i++) {
+			pBurnDrvNameIndex[i] = i;
+		}
+		qsort(pBurnDrvNameIndex, nBurnDrvCount, sizeof(UINT32), BurnDrvNameIndexCompare);
+	}
+
 	cmc_4p_Precalc();
 	bBurnUseMMX = BurnCheckMMXSupport();
 
@@ -94,9 +110,51 @@ extern "C" INT32 BurnLibExit()
 {
 	nBurnDrvCount = 0;
 
+	free(pBurnDrvNameIndex);
+	pBurnDrvNameIndex = NULL;
+
+	BurnThreadsExit();
+
 	return 0;
 }
 
+// Find a driver by its zip name, returns the driver number or -1 if there's no such driver
+extern "C" INT32 BurnDrvFind(const char* szName)
+{
+	if (szName == NULL) {
+		return -1;
+	}
+
+	if (pBurnDrvNameIndex == NULL) {
+		for (UINT32 i = 0; i < nBurnDrvCount; i++) {
+			if (strcmp(szName, pDriver[i]->szShortName) == 0) {
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	INT32 nLow = 0, nHigh = nBurnDrvCount - 1;
+
+	while (nLow <= nHigh) {
+		INT32 nMid = (nLow + nHigh) / 2;
+		INT32 nCmp = strcmp(szName, pDriver[pBurnDrvNameIndex[nMid]]->szShortName);
+
+		if (nCmp == 0) {
+			return pBurnDrvNameIndex[nMid];
+		}
+
+		if (nCmp < 0) {
+			nHigh = nMid - 1;
+		} else {
+			nLow = nMid + 1;
+		}
+	}
+
+	return -1;
+}
+
 INT32 BurnGetZipName(char** pszName, UINT32 i)
 {
 	static char szFilename[MAX_PATH];
@@ -127,13 +185,14 @@ INT32 BurnGetZipName(char** pszName, UINT32 i)
 					break;
 				}
 
-				for (nBurnDrvActive = 0; nBurnDrvActive < nBurnDrvCount; nBurnDrvActive++) {
-		            if (strcmp(pszParent, pDriver[nBurnDrvActive]->szShortName) == 0) {	// Found parent
-						pszGameName = pDriver[nBurnDrvActive]->szShortName;
-						break;
-					}
+				INT32 nParent = BurnDrvFind(pszParent);
+				if (nParent < 0) {									// Parent isn't in the build
+					break;
 				}
 
+				nBurnDrvActive = nParent;							// Found parent
+				pszGameName = pDriver[nBurnDrvActive]->szShortName;
+
 				j++;
 			}
 		}
@@ -424,11 +483,10 @@ extern "C" char* BurnDrvGetTextA(UINT32 i)
 #if defined (_UNICODE)
 void BurnLocalisationSetName(char *szName, TCHAR *szLongName)
 {
-	for (UINT32 i = 0; i < nBurnDrvCount; i++) {
-		nBurnDrvActive = i;
-		if (!strcmp(szName, pDriver[i]->szShortName)) {
-			pDriver[i]->szFullNameW = szLongName;
-		}
+	INT32 i = BurnDrvFind(szName);
+
+	if (i >= 0) {
+		pDriver[i]->szFullNameW = szLongName;
 	}
 }
 #endif
@@ -645,6 +703,7 @@ extern "C" INT32 BurnDrvInit()
 
 	CheatInit();
 	HiscoreInit();
+	BurnIdleInit();
 	BurnStateInit();
 	BurnInitMemoryManager();
 	BurnRandomInit();
@@ -689,6 +748,7 @@ extern "C" INT32 BurnDrvExit()
 	HiscoreExit(); // must come before CheatExit() (uses cheat cpu-registry)
 	CheatExit();
 	CheatSearchExit();
+	BurnIdleExit();
 	BurnStateExit();
 	
 	nBurnCPUSpeedAdjust = 0x0100;
@@ -697,6 +757,7 @@ extern "C" INT32 BurnDrvExit()
 	
 	INT32 nRet = pDriver[nBurnDrvActive]->Exit();			// Forward to drivers function
 	
+	BurnSoundMixExit();
 	BurnExitMemoryManager();
 #if defined FBNEO_DEBUG
 	DebugTrackerExit();
@@ -741,16 +802,26 @@ INT32 BurnDrvCartridgeSetup(BurnCartrigeCommand nCommand)
 // Do one frame of game emulation
 extern "C" INT32 BurnDrvFrame()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_FRAME);
+
 	CheatApply();									// Apply cheats (if any)
 	HiscoreApply();
-	return pDriver[nBurnDrvActive]->Frame();		// Forward to drivers function
+
+	INT32 nRet = pDriver[nBurnDrvActive]->Frame();	// Forward to drivers function
+	BurnTransferEndFrame();
+	BurnVideoPipelineEndFrame();
+
+	return nRet;
 }
 
 // Force redraw of the screen
 extern "C" INT32 BurnDrvRedraw()
 {
 	if (pDriver[nBurnDrvActive]->Redraw) {
-		return pDriver[nBurnDrvActive]->Redraw();	// Forward to drivers function
+		INT32 nRet = pDriver[nBurnDrvActive]->Redraw();	// Forward to drivers function
+		BurnTransferEndFrame();
+
+		return nRet;
 	}
 
 	return 1;										// No funtion provide, so simply return
@@ -821,6 +892,8 @@ inline static INT32 BurnClearSize(INT32 w, INT32 h)
 
 	w *= nBurnBpp;
 
+	BurnTransferInvalidate();
+
 	// clear the screen to zero
 	for (pl = pBurnDraw, y = 0; y < h; pl += nBurnPitch, y++) {
 		memset(pl, 0x00, w);
@@ -250,6 +250,21 @@ extern clock_t starttime;					// system time when emulation started and after ro
 extern bool bForce60Hz;
 extern bool bBurnUseBlend;
 
+extern bool bBurnDecryptCache;				// Keep decrypted ROMs on disk (see burn_cache.h)
+extern TCHAR szBurnDecryptCachePath[MAX_PATH];
+
+extern bool bBurnIdleDetect;				// Skip the rest of a timeslice spent in an idle loop (see burn_idle.h)
+
+extern bool bBurnSh2Recompiler;				// Let the drivers that support it use the x86-64 SH-2 recompiler (SH2_X64_DRC builds)
+extern bool bBurnArm7Recompiler;			// Let the drivers that support it use the x86-64 ARM7 recompiler (ARM7_X64_DRC builds)
+
+extern bool bBurnTransferDirtyRows;			// Only convert rows of pTransDraw that changed, pBurnDraw must be kept between frames
+void BurnTransferInvalidate();				// Call after drawing on pBurnDraw, so the next frame is converted in full
+void BurnTransferEndFrame();
+
+extern bool bBurnVideoPipeline;				// Draw each frame on a thread while the next is emulated, for drivers that support it
+void BurnVideoPipelineEndFrame();
+
 extern INT32 nBurnFPS;
 extern INT32 nBurnCPUSpeedAdjust;
 
@@ -297,6 +312,8 @@ extern INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...);
 INT32 BurnLibInit();
 INT32 BurnLibExit();
 
+INT32 BurnDrvFind(const char* szName);				// Driver number from zip name, or -1
+
 INT32 BurnDrvInit();
 INT32 BurnDrvExit();
 
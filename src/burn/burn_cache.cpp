@@ -0,0 +1,177 @@
+// FB Neo decrypted ROM cache, see burn_cache.h
+
+#include "burnint.h"
+
+#if defined (_WIN32)
+ #include <direct.h>
+ #define BurnCacheMakeDir(x)	_tmkdir(x)
+#else
+ #include <sys/stat.h>
+ #define BurnCacheMakeDir(x)	mkdir(x, 0777)
+#endif
+
+#define BURN_CACHE_VERSION		(3)
+
+bool bBurnDecryptCache = false;
+TCHAR szBurnDecryptCachePath[MAX_PATH] = _T("cache/");
+
+struct BurnCacheHeader {
+	char szMagic[8];
+	UINT32 nVersion;
+	INT32 nBurnVer;				// build that decrypted it, a fix to the decryption makes old files stale
+	UINT32 nRomKey;				// CRC of the driver's ROM list and the region name
+	UINT32 nSrcCrc;				// CRC of the ROM data it was decrypted from
+	UINT32 nLen;
+	UINT32 nDataCrc;
+};
+
+static const char szBurnCacheMagic[8] = { 'F', 'B', 'N', 'C', 'A', 'C', 'H', 'E' };
+
+static UINT32 BurnCacheCrcTable[256];
+static bool bBurnCacheCrcTable = false;
+
+UINT32 BurnCacheCrc(UINT32 nCrc, const UINT8* pData, INT32 nLen)
+{
+	if (!bBurnCacheCrcTable) {
+		for (UINT32 i = 0; i < 256; i++) {
+			UINT32 c = i;
+			for (INT32 j = 0; j < 8; j++) {
+				c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+			}
+			BurnCacheCrcTable[i] = c;
+		}
+		bBurnCacheCrcTable = true;
+	}
+
+	nCrc = ~nCrc;
+	for (INT32 i = 0; i < nLen; i++) {
+		nCrc = BurnCacheCrcTable[(nCrc ^ pData[i]) & 0xff] ^ (nCrc >> 8);
+	}
+
+	return ~nCrc;
+}
+
+// Anything that changes the ROMs the region was decrypted from changes the key
+static UINT32 BurnCacheRomKey(const TCHAR* szTag)
+{
+	struct BurnRomInfo ri;
+	UINT32 nKey = 0;
+
+	for (INT32 i = 0; BurnDrvGetRomInfo(&ri, i) == 0; i++) {
+		UINT32 nRom[2] = { ri.nCrc, ri.nLen };
+		nKey = BurnCacheCrc(nKey, (const UINT8*)nRom, sizeof(nRom));
+	}
+
+	return BurnCacheCrc(nKey, (const UINT8*)szTag, _tcslen(szTag) * sizeof(TCHAR));
+}
+
+static void BurnCacheName(TCHAR* szName, const TCHAR* szTag)
+{
+	_stprintf(szName, _T("%s%s_%s.dec"), szBurnDecryptCachePath, BurnDrvGetText(DRV_NAME), szTag);
+}
+
+// Returns 0 if the file was made for this build, driver, region and length
+static INT32 BurnCacheReadHeader(FILE* fp, const TCHAR* szTag, INT32 nLen, struct BurnCacheHeader* pHeader)
+{
+	if (fread(pHeader, sizeof(*pHeader), 1, fp) == 1 && memcmp(pHeader->szMagic, szBurnCacheMagic, sizeof(szBurnCacheMagic)) == 0 &&
+		pHeader->nVersion == BURN_CACHE_VERSION && pHeader->nBurnVer == nBurnVer && pHeader->nRomKey == BurnCacheRomKey(szTag) && pHeader->nLen == (UINT32)nLen) {
+		return 0;
+	}
+
+	return 1;
+}
+
+INT32 BurnCacheCheck(const TCHAR* szTag, INT32 nLen)
+{
+	if (!bBurnDecryptCache || nLen <= 0) {
+		return 1;
+	}
+
+	TCHAR szName[MAX_PATH];
+	BurnCacheName(szName, szTag);
+
+	FILE* fp = _tfopen(szName, _T("rb"));
+	if (fp == NULL) {
+		return 1;
+	}
+
+	struct BurnCacheHeader Header;
+	INT32 nRet = BurnCacheReadHeader(fp, szTag, nLen, &Header);
+
+	fclose(fp);
+
+	return nRet;
+}
+
+INT32 BurnCacheLoad(const TCHAR* szTag, UINT32 nSrcCrc, UINT8* pDest, INT32 nLen)
+{
+	if (!bBurnDecryptCache || pDest == NULL || nLen <= 0) {
+		return 1;
+	}
+
+	TCHAR szName[MAX_PATH];
+	BurnCacheName(szName, szTag);
+
+	FILE* fp = _tfopen(szName, _T("rb"));
+	if (fp == NULL) {
+		return 1;
+	}
+
+	struct BurnCacheHeader Header;
+	INT32 nRet = 1;
+
+	if (BurnCacheReadHeader(fp, szTag, nLen, &Header) == 0 && Header.nSrcCrc == nSrcCrc) {
+		if (fread(pDest, 1, nLen, fp) == (UINT32)nLen && BurnCacheCrc(0, pDest, nLen) == Header.nDataCrc) {
+			nRet = 0;
+		}
+	}
+
+	fclose(fp);
+
+	if (nRet) {
+		bprintf(PRINT_IMPORTANT, _T("*** Decrypted ROM cache %s is out of date, decrypting again.\n"), szName);
+	}
+
+	return nRet;
+}
+
+INT32 BurnCacheSave(const TCHAR* szTag, UINT32 nSrcCrc, const UINT8* pSrc, INT32 nLen)
+{
+	if (!bBurnDecryptCache || pSrc == NULL || nLen <= 0) {
+		return 1;
+	}
+
+	TCHAR szName[MAX_PATH];
+	BurnCacheName(szName, szTag);
+
+	FILE* fp = _tfopen(szName, _T("wb"));
+	if (fp == NULL) {
+		// The first save makes the directory
+		BurnCacheMakeDir(szBurnDecryptCachePath);
+		fp = _tfopen(szName, _T("wb"));
+	}
+	if (fp == NULL) {
+		bprintf(PRINT_ERROR, _T("*** Can't write the decrypted ROM cache %s.\n"), szName);
+		return 1;
+	}
+
+	struct BurnCacheHeader Header;
+	memcpy(Header.szMagic, szBurnCacheMagic, sizeof(szBurnCacheMagic));
+	Header.nVersion = BURN_CACHE_VERSION;
+	Header.nBurnVer = nBurnVer;
+	Header.nRomKey = BurnCacheRomKey(szTag);
+	Header.nSrcCrc = nSrcCrc;
+	Header.nLen = nLen;
+	Header.nDataCrc = BurnCacheCrc(0, pSrc, nLen);
+
+	INT32 nRet = (fwrite(&Header, sizeof(Header), 1, fp) == 1 && fwrite(pSrc, 1, nLen, fp) == (UINT32)nLen) ? 0 : 1;
+
+	fclose(fp);
+
+	// A partial file is caught by the checksum when it's loaded
+	if (nRet) {
+		bprintf(PRINT_ERROR, _T("*** Can't write the decrypted ROM cache %s.\n"), szName);
+	}
+
+	return nRet;
+}
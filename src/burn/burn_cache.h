@@ -0,0 +1,31 @@
+// FB Neo decrypted ROM cache
+//
+// Some boards (CPS2, CPS3, Neo Geo CMC) spend seconds decrypting their ROMs every time they're
+// started.  When bBurnDecryptCache is set, a driver can keep the decrypted result of a region in
+// szBurnDecryptCachePath and read it back next time instead.  Cache files are named after the
+// driver and the region, and are only used if they were made by this build of the library from
+// the same CRCs in the driver's ROM list and the same length, and the data passes its checksum.
+//
+// The driver still loads the ROMs a region is decrypted from, and passes the CRC of what it loaded
+// (nSrcCrc, see BurnCacheCrc()).  A file made from different data, eg. a bad or modified dump, or
+// one a ROM is missing from, isn't used.  Only the decryption is skipped.
+
+#ifndef _BURN_CACHE_H
+#define _BURN_CACHE_H
+
+// CRC-32 of nLen bytes, continuing from nCrc (0 to start)
+UINT32 BurnCacheCrc(UINT32 nCrc, const UINT8* pData, INT32 nLen);
+
+// Returns 0 if there's a cache file for region szTag that BurnCacheLoad() may be able to use, for
+// drivers that only want to CRC the source ROMs when they'd get something for it
+INT32 BurnCacheCheck(const TCHAR* szTag, INT32 nLen);
+
+// Fill pDest with the cached copy of region szTag, if it was decrypted from source data with CRC
+// nSrcCrc, returns 0 if it was loaded.  On failure pDest may have been written to.
+INT32 BurnCacheLoad(const TCHAR* szTag, UINT32 nSrcCrc, UINT8* pDest, INT32 nLen);
+
+// Store region szTag after decrypting it from source data with CRC nSrcCrc, does nothing unless
+// bBurnDecryptCache is set
+INT32 BurnCacheSave(const TCHAR* szTag, UINT32 nSrcCrc, const UINT8* pSrc, INT32 nLen);
+
+#endif
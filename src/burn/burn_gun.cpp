@@ -466,6 +466,8 @@ void BurnGunDrawTarget(INT32 num, INT32 x, INT32 y)
 
 	if (bBurnGunAutoHide && !GunTargetShouldDraw(num)) return;
 
+	BurnTransferInvalidate();
+
 	UINT8* pTile = pBurnDraw + nBurnGunMaxX * nBurnBpp * (y - 1) + nBurnBpp * x;
 	
 	UINT32 nTargetCol = 0;
@@ -0,0 +1,136 @@
+// FB Neo idle loop detector, see burn_idle.h
+
+#include "burnint.h"
+
+#define BURN_IDLE_MAX_FOUND		(64)
+
+bool bBurnIdleDetect = false;
+
+struct BurnIdleLoop {
+	TCHAR szCpu[16];
+	INT32 nCpu;
+	UINT32 nBranch;
+};
+
+static BurnIdleLoop BurnIdleFound[BURN_IDLE_MAX_FOUND];
+static INT32 nBurnIdleFound;
+static INT32 nBurnIdleSaved;			// loops that were already in the file
+
+static void BurnIdleName(TCHAR* szName)
+{
+	_stprintf(szName, _T("%s%s.idle"), szAppEEPROMPath, BurnDrvGetText(DRV_NAME));
+}
+
+static BurnIdleLoop* BurnIdleFind(const TCHAR* szCpu, INT32 nCpu, UINT32 nBranch)
+{
+	for (INT32 i = 0; i < nBurnIdleFound; i++) {
+		BurnIdleLoop* pLoop = &BurnIdleFound[i];
+		if (pLoop->nBranch == nBranch && pLoop->nCpu == nCpu && _tcscmp(pLoop->szCpu, szCpu) == 0) {
+			return pLoop;
+		}
+	}
+
+	return NULL;
+}
+
+static void BurnIdleAdd(const TCHAR* szCpu, INT32 nCpu, UINT32 nBranch)
+{
+	if (nBurnIdleFound >= BURN_IDLE_MAX_FOUND || BurnIdleFind(szCpu, nCpu, nBranch)) {
+		return;
+	}
+
+	BurnIdleLoop* pLoop = &BurnIdleFound[nBurnIdleFound++];
+
+	_tcsncpy(pLoop->szCpu, szCpu, 15);
+	pLoop->szCpu[15] = 0;
+	pLoop->nCpu = nCpu;
+	pLoop->nBranch = nBranch;
+}
+
+// Read the loops found in earlier runs, so only new ones are logged
+void BurnIdleInit()
+{
+	nBurnIdleFound = nBurnIdleSaved = 0;
+
+	if (!bBurnIdleDetect) {
+		return;
+	}
+
+	TCHAR szName[MAX_PATH];
+	BurnIdleName(szName);
+
+	FILE* fp = _tfopen(szName, _T("rt"));
+	if (fp == NULL) {
+		return;
+	}
+
+	TCHAR szLine[64];
+	while (_fgetts(szLine, 64, fp)) {
+		// "<cpu> #<n> <branch pc in hex>"
+		TCHAR* p = szLine;
+		while (*p && *p != _T(' ')) p++;
+		if (p[0] != _T(' ') || p[1] != _T('#')) {
+			continue;
+		}
+		*p = 0;
+
+		TCHAR* pEnd;
+		INT32 nCpu = _tcstol(p + 2, &pEnd, 10);
+		UINT32 nBranch = _tcstol(pEnd, NULL, 16);
+
+		BurnIdleAdd(szLine, nCpu, nBranch);
+	}
+
+	fclose(fp);
+
+	nBurnIdleSaved = nBurnIdleFound;
+}
+
+// Add the loops found this time to the file
+void BurnIdleExit()
+{
+	if (bBurnIdleDetect && nBurnIdleFound > nBurnIdleSaved) {
+		TCHAR szName[MAX_PATH];
+		BurnIdleName(szName);
+
+		FILE* fp = _tfopen(szName, _T("at"));
+		if (fp) {
+			for (INT32 i = nBurnIdleSaved; i < nBurnIdleFound; i++) {
+				_ftprintf(fp, _T("%s #%d %08x\n"), BurnIdleFound[i].szCpu, BurnIdleFound[i].nCpu, BurnIdleFound[i].nBranch);
+			}
+			fclose(fp);
+		}
+	}
+
+	nBurnIdleFound = nBurnIdleSaved = 0;
+}
+
+INT32 BurnIdleCheck(struct BurnIdleState* pIdle, const TCHAR* szCpu, INT32 nCpu, UINT32 nBranch, UINT32 nWrites, const void* pState, INT32 nSize)
+{
+	if (nSize > BURN_IDLE_MAX_STATE) {
+		nSize = BURN_IDLE_MAX_STATE;
+	}
+
+	// Anything different since last time round starts the count again
+	if (nBranch != pIdle->nBranch || nWrites != pIdle->nWrites || memcmp(pIdle->State, pState, nSize)) {
+		pIdle->nBranch = nBranch;
+		pIdle->nWrites = nWrites;
+		pIdle->nCount = 0;
+		memcpy(pIdle->State, pState, nSize);
+
+		return 0;
+	}
+
+	if (pIdle->nCount < BURN_IDLE_PASSES) {
+		if (++pIdle->nCount < BURN_IDLE_PASSES) {
+			return 0;
+		}
+
+		if (BurnIdleFind(szCpu, nCpu, nBranch) == NULL) {
+			bprintf(PRINT_IMPORTANT, _T("Idle loop: %s #%d branch at %x\n"), szCpu, nCpu, nBranch);
+			BurnIdleAdd(szCpu, nCpu, nBranch);
+		}
+	}
+
+	return 1;
+}
@@ -0,0 +1,32 @@
+// FB Neo idle loop detector
+//
+// Games spend a large part of each frame spinning in a short loop until vblank or another cpu
+// changes something.  When bBurnIdleDetect is set, the Sek and Zet interfaces pass every short
+// taken backward branch to BurnIdleCheck(), along with the cpu's registers and a count of the
+// writes it has made.  A loop that goes round BURN_IDLE_PASSES times with the registers and flags
+// unchanged and nothing written can only be left by an interrupt or by another cpu, so the cpu
+// gives up the rest of its timeslice.  Each loop found is logged, and saved as <driver>.idle in
+// szAppEEPROMPath so it can be reviewed (or made into a proper speedhack).
+
+#ifndef _BURN_IDLE_H
+#define _BURN_IDLE_H
+
+#define BURN_IDLE_MAX_LOOP		(0x40)		// bytes from the start of the loop to the branch
+#define BURN_IDLE_PASSES		(4)			// times round unchanged before it counts as idle
+#define BURN_IDLE_MAX_STATE		(0x60)		// bytes of register state
+
+struct BurnIdleState {
+	UINT32 nBranch;						// pc of the branch last taken
+	UINT32 nWrites;						// the cpu's write count then
+	INT32 nCount;						// times round with nothing changed
+	UINT8 State[BURN_IDLE_MAX_STATE];	// registers then
+};
+
+void BurnIdleInit();
+void BurnIdleExit();
+
+// Call on a taken branch from nBranch back to a pc no more than BURN_IDLE_MAX_LOOP bytes before it.
+// Returns 1 if the loop is idle and the rest of the timeslice can be skipped.
+INT32 BurnIdleCheck(struct BurnIdleState* pIdle, const TCHAR* szCpu, INT32 nCpu, UINT32 nBranch, UINT32 nWrites, const void* pState, INT32 nSize);
+
+#endif
@@ -8,88 +8,196 @@
 
 #define LOG_MEMORY_USAGE 0
 
-#define MAX_MEM_PTR	0x400 // more than 1024 malloc calls should be insane...
-
-static UINT8 *memptr[MAX_MEM_PTR]; // pointer to allocated memory
-static INT32 memsize[MAX_MEM_PTR];
+// Allocations are tracked in an open-addressed hash table keyed on the pointer, so
+// BurnMalloc/BurnFree don't have to search for a slot and there's no limit on the number of
+// allocations a driver can make.  The table grows as needed and is freed in BurnExitMemoryManager.
+
+#define MEM_TABLE_INIT	0x400 // must be a power of 2
+#define MEM_DELETED		((UINT8*)1) // slot of a freed pointer, keeps the probe chains intact
+
+struct BurnMemEntry {
+	UINT8 *ptr;
+	INT32 size;
+	INT32 line;
+	const char *file;
+};
+
+static struct BurnMemEntry *memtable = NULL;
+static INT32 memtable_size = 0;
+static INT32 memtable_count = 0; // live entries
+static INT32 memtable_used = 0; // live + deleted entries
 static INT32 mem_allocated;
 
+static inline UINT32 MemHash(const void *ptr)
+{
+	UINT64 n = (UINT64)(uintptr_t)ptr;
+
+	return (UINT32)((n >> 4) * 0x9e3779b97f4a7c15ULL >> 32);
+}
+
+static struct BurnMemEntry *MemFind(const void *ptr)
+{
+	if (ptr == NULL || memtable == NULL) {
+		return NULL;
+	}
+
+	UINT32 mask = memtable_size - 1;
+
+	for (UINT32 i = MemHash(ptr) & mask; memtable[i].ptr != NULL; i = (i + 1) & mask) {
+		if (memtable[i].ptr == ptr) {
+			return &memtable[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void MemInsert(UINT8 *ptr, INT32 size, const char *file, INT32 line)
+{
+	UINT32 mask = memtable_size - 1;
+	UINT32 i = MemHash(ptr) & mask;
+
+	while (memtable[i].ptr != NULL && memtable[i].ptr != MEM_DELETED) {
+		i = (i + 1) & mask;
+	}
+
+	if (memtable[i].ptr == NULL) {
+		memtable_used++;
+	}
+
+	memtable[i].ptr = ptr;
+	memtable[i].size = size;
+	memtable[i].file = file;
+	memtable[i].line = line;
+	memtable_count++;
+}
+
+static void MemRemove(struct BurnMemEntry *entry)
+{
+	entry->ptr = MEM_DELETED;
+	entry->size = 0;
+	memtable_count--;
+}
+
+// Make sure there's room for one more entry, keeping the table at most 3/4 full
+static INT32 MemTableReserve()
+{
+	if (memtable != NULL && (memtable_used + 1) * 4 <= memtable_size * 3) {
+		return 0;
+	}
+
+	struct BurnMemEntry *oldtable = memtable;
+	INT32 oldsize = memtable_size;
+
+	INT32 newsize = (oldsize) ? oldsize : MEM_TABLE_INIT;
+	while ((memtable_count + 1) * 2 > newsize) { // rehash into a table that's at most half full
+		newsize <<= 1;
+	}
+
+	memtable = (struct BurnMemEntry*)calloc(newsize, sizeof(struct BurnMemEntry));
+	if (memtable == NULL) {
+		memtable = oldtable;
+		return 1;
+	}
+
+	memtable_size = newsize;
+	memtable_count = 0;
+	memtable_used = 0;
+
+	for (INT32 i = 0; i < oldsize; i++) {
+		if (oldtable[i].ptr != NULL && oldtable[i].ptr != MEM_DELETED) {
+			MemInsert(oldtable[i].ptr, oldtable[i].size, oldtable[i].file, oldtable[i].line);
+		}
+	}
+
+	free (oldtable);
+
+	return 0;
+}
+
 // this should be called early on... BurnDrvInit?
 
 void BurnInitMemoryManager()
 {
-	memset (memptr, 0, sizeof(memptr));
-	memset (memsize, 0, sizeof(memsize));
+	free (memtable);
+	memtable = NULL;
+	memtable_size = 0;
+	memtable_count = 0;
+	memtable_used = 0;
 	mem_allocated = 0;
+
+	MemTableReserve();
 }
 
 // call BurnMalloc() instead of 'malloc' (see macro in burnint.h)
 UINT8 *_BurnMalloc(INT32 size, char *file, INT32 line)
 {
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
-	{
-		if (memptr[i] == NULL) {
-			memptr[i] = (UINT8*)malloc(size);
+	if (MemTableReserve()) {
+		bprintf (0, _T("BurnMalloc failed to grow the allocation table!\n"));
+		return NULL;
+	}
 
-			if (memptr[i] == NULL) {
-				bprintf (0, _T("BurnMalloc failed to allocate %d bytes of memory!\n"), size);
-				return NULL;
-			}
+	UINT8 *ptr = (UINT8*)calloc(1, size); // contents set to 0, large blocks come straight from the os already cleared
 
-			memset (memptr[i], 0, size); // set contents to 0
+	if (ptr == NULL) {
+		bprintf (0, _T("BurnMalloc failed to allocate %d bytes of memory!\n"), size);
+		return NULL;
+	}
 
-			mem_allocated += size;
-			memsize[i] = size;
+	MemInsert(ptr, size, file, line);
+	mem_allocated += size;
 
 #if LOG_MEMORY_USAGE
-			bprintf (0, _T("(%S:%d) BurnMalloc(%d): index %d.  %d total!\n"), file, line, size, i, mem_allocated);
+	bprintf (0, _T("(%S:%d) BurnMalloc(%d): %d allocations.  %d total!\n"), file, line, size, memtable_count, mem_allocated);
 #endif
 
-			return memptr[i];
-		}
-	}
-
-	bprintf (0, _T("BurnMalloc called too many times!\n"));
-
-	return NULL; // Freak out!
+	return ptr;
 }
 
 UINT8 *BurnRealloc(void *ptr, INT32 size)
 {
-	UINT8 *mptr = (UINT8*)ptr;
+	struct BurnMemEntry *entry = MemFind(ptr);
 
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
-	{
-		if (memptr[i] == mptr) {
-			memptr[i] = (UINT8*)realloc(ptr, size);
-			mem_allocated -= memsize[i];
-			mem_allocated += size;
-			memsize[i] = size;
-			return memptr[i];
-		}
+	if (entry == NULL) {
+		return NULL;
 	}
 
-	return NULL;
+	UINT8 *newptr = (UINT8*)realloc(ptr, size);
+	if (newptr == NULL) {
+		return NULL;
+	}
+
+	const char *file = entry->file;
+	INT32 line = entry->line;
+
+	mem_allocated -= entry->size;
+	mem_allocated += size;
+
+	if (newptr == ptr) {
+		entry->size = size;
+	} else {
+		// the entry is keyed on the pointer, so it has to move
+		MemRemove(entry);
+		MemTableReserve();
+		MemInsert(newptr, size, file, line);
+	}
+
+	return newptr;
 }
 
 // call BurnFree() instead of "free" (see macro in burnint.h)
 void _BurnFree(void *ptr)
 {
-	UINT8 *mptr = (UINT8*)ptr;
+	struct BurnMemEntry *entry = MemFind(ptr);
 
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
-	{
-		if (mptr != NULL && memptr[i] == mptr) {
-			free (memptr[i]);
-			memptr[i] = NULL;
+	if (entry != NULL) {
+		free (entry->ptr);
 
-			mem_allocated -= memsize[i];
-			memsize[i] = 0;
+		mem_allocated -= entry->size;
+		MemRemove(entry);
 #if LOG_MEMORY_USAGE
-			bprintf(0, _T("BurnFree(): index %d.  %d total!\n"), i, mem_allocated);
+		bprintf(0, _T("BurnFree(): %d allocations.  %d total!\n"), memtable_count, mem_allocated);
 #endif
-			break;
-		}
 	}
 }
 
@@ -97,19 +205,21 @@ void _BurnFree(void *ptr)
 
 void BurnExitMemoryManager()
 {
-	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
+	for (INT32 i = 0; i < memtable_size; i++)
 	{
-		if (memptr[i] != NULL) {
+		if (memtable[i].ptr != NULL && memtable[i].ptr != MEM_DELETED) {
 #if defined FBNEO_DEBUG
-			bprintf(PRINT_ERROR, _T("BurnExitMemoryManager had to free mem pointer %i (%d bytes)\n"), i, memsize[i]);
+			bprintf(PRINT_ERROR, _T("BurnExitMemoryManager had to free mem pointer allocated at %S:%d (%d bytes)\n"), memtable[i].file, memtable[i].line, memtable[i].size);
 #endif
-			free (memptr[i]);
-			memptr[i] = NULL;
-
-			mem_allocated -= memsize[i];
-			memsize[i] = 0;
+			free (memtable[i].ptr);
 		}
 	}
 
+	free (memtable);
+	memtable = NULL;
+	memtable_size = 0;
+	memtable_count = 0;
+	memtable_used = 0;
+
 	mem_allocated = 0;
 }
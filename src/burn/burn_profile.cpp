@@ -0,0 +1,60 @@
+// FB Neo profiling zones, see burn_profile.h
+
+#include "burnint.h"
+
+#include <chrono>
+
+bool bBurnProfileZones = false;
+UINT32 nBurnProfileFrames = 0;
+UINT64 nBurnProfileNested = 0;
+
+struct BurnProfileZone BurnProfileZoneInfo[PRF_ZONE_MAX] = {
+	{ "frame"     }, { "sek"       }, { "zet"      }, { "sh2"     }, { "arm7"    }, { "mips3"   },
+	{ "draw"      }, { "transfer"  },
+	{ "ym2151"    }, { "ym2203"    }, { "ym2608"   }, { "ym2610"  }, { "ym2612"  }, { "ym3812"  },
+	{ "msm6295"   }, { "msm5205"   }, { "upd7759"  }, { "ymz280b" }, { "k054539" }, { "ics2115" },
+	{ "es5506"    }, { "qsound"    }, { "cps3snd"  },
+	{ "vidframe"  }, { "vidpaint"  }, { "audio"    },
+};
+
+UINT64 BurnProfileGetTicks()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void BurnProfileZonesReset()
+{
+	for (INT32 i = 0; i < PRF_ZONE_MAX; i++) {
+		BurnProfileZoneInfo[i].nTicks = 0;
+		BurnProfileZoneInfo[i].nSelfTicks = 0;
+		BurnProfileZoneInfo[i].nCalls = 0;
+		BurnProfileZoneInfo[i].nTotalTicks = 0;
+		BurnProfileZoneInfo[i].nTotalSelfTicks = 0;
+		BurnProfileZoneInfo[i].nTotalCalls = 0;
+		BurnProfileZoneInfo[i].nMaxTicks = 0;
+	}
+
+	nBurnProfileFrames = 0;
+	nBurnProfileNested = 0;
+}
+
+void BurnProfileZonesFrameEnd()
+{
+	for (INT32 i = 0; i < PRF_ZONE_MAX; i++) {
+		struct BurnProfileZone* pz = &BurnProfileZoneInfo[i];
+
+		pz->nTotalTicks += pz->nTicks;
+		pz->nTotalSelfTicks += pz->nSelfTicks;
+		pz->nTotalCalls += pz->nCalls;
+		if (pz->nTicks > pz->nMaxTicks) {
+			pz->nMaxTicks = pz->nTicks;
+		}
+
+		pz->nTicks = 0;
+		pz->nSelfTicks = 0;
+		pz->nCalls = 0;
+	}
+
+	nBurnProfileFrames++;
+	nBurnProfileNested = 0;
+}
@@ -0,0 +1,111 @@
+// FB Neo profiling zones
+//
+// Scoped timers around the hot paths of a frame (cpu cores, drawing, sound chips and the
+// frontend's video/audio output), so it's possible to see where the time in a frame goes
+// without attaching an external profiler.  Zones are off unless bBurnProfileZones is set,
+// and cost a single test when off.  Nested zones are timed inclusively, eg. a sound chip
+// rendered from a timer callback inside ZetRun() is counted in both zones, and each zone's
+// self time is what's left once the zones nested inside it are taken out.
+
+#ifndef _BURN_PROFILE_H
+#define _BURN_PROFILE_H
+
+enum BurnProfileZones {
+	PRF_ZONE_FRAME = 0,			// BurnDrvFrame(), everything the driver does in a frame
+
+	PRF_ZONE_SEK,				// cpu cores
+	PRF_ZONE_ZET,
+	PRF_ZONE_SH2,
+	PRF_ZONE_ARM7,
+	PRF_ZONE_MIPS3,
+
+	PRF_ZONE_DRAW,				// driver draw functions (only the larger drivers are instrumented)
+	PRF_ZONE_TRANSFER,			// BurnTransferCopy()
+
+	PRF_ZONE_YM2151,			// sound chips
+	PRF_ZONE_YM2203,
+	PRF_ZONE_YM2608,
+	PRF_ZONE_YM2610,
+	PRF_ZONE_YM2612,
+	PRF_ZONE_YM3812,
+	PRF_ZONE_MSM6295,
+	PRF_ZONE_MSM5205,
+	PRF_ZONE_UPD7759,
+	PRF_ZONE_YMZ280B,
+	PRF_ZONE_K054539,
+	PRF_ZONE_ICS2115,
+	PRF_ZONE_ES5506,
+	PRF_ZONE_QSOUND,
+	PRF_ZONE_CPS3SND,
+
+	PRF_ZONE_VIDFRAME,			// frontend, VidFrame() (includes PRF_ZONE_FRAME when drawing)
+	PRF_ZONE_VIDPAINT,			// frontend, presenting the image
+	PRF_ZONE_AUDIO,				// frontend, handing a frame of sound to the audio device
+
+	PRF_ZONE_MAX
+};
+
+#define PRF_ZONE_SOUND_FIRST	PRF_ZONE_YM2151
+#define PRF_ZONE_SOUND_LAST		PRF_ZONE_CPS3SND
+
+struct BurnProfileZone {
+	const char* szName;
+	UINT64 nTicks;				// this frame
+	UINT64 nSelfTicks;			// this frame, less the zones nested inside this one
+	UINT32 nCalls;
+	UINT64 nTotalTicks;			// since BurnProfileZonesReset()
+	UINT64 nTotalSelfTicks;
+	UINT64 nTotalCalls;
+	UINT64 nMaxTicks;			// worst single frame
+};
+
+extern bool bBurnProfileZones;
+extern struct BurnProfileZone BurnProfileZoneInfo[PRF_ZONE_MAX];
+extern UINT32 nBurnProfileFrames;
+extern UINT64 nBurnProfileNested;		// time in zones nested inside the innermost open one
+
+UINT64 BurnProfileGetTicks();			// nanoseconds, monotonic
+void BurnProfileZonesReset();
+void BurnProfileZonesFrameEnd();		// fold this frame's times into the totals and clear them
+
+// nNested is nBurnProfileNested from when the zone was entered
+inline static void BurnProfileZoneAdd(INT32 nZone, UINT64 nStart, UINT64 nNested)
+{
+	UINT64 nTicks = BurnProfileGetTicks() - nStart;
+
+	BurnProfileZoneInfo[nZone].nTicks += nTicks;
+	BurnProfileZoneInfo[nZone].nSelfTicks += nTicks - nBurnProfileNested;
+	BurnProfileZoneInfo[nZone].nCalls++;
+
+	nBurnProfileNested = nNested + nTicks;
+}
+
+#ifdef __cplusplus
+class BurnProfileScope {
+public:
+	BurnProfileScope(INT32 nZone) : nScopeZone(nZone), nScopeStart(0), nScopeNested(0)
+	{
+		if (bBurnProfileZones) {
+			nScopeNested = nBurnProfileNested;
+			nBurnProfileNested = 0;
+			nScopeStart = BurnProfileGetTicks();
+		}
+	}
+
+	~BurnProfileScope()
+	{
+		if (nScopeStart) {
+			BurnProfileZoneAdd(nScopeZone, nScopeStart, nScopeNested);
+		}
+	}
+
+private:
+	INT32 nScopeZone;
+	UINT64 nScopeStart;
+	UINT64 nScopeNested;
+};
+
+#define BURN_PROFILE_ZONE(zone)	BurnProfileScope BurnProfileScope_##zone(zone)
+#endif
+
+#endif
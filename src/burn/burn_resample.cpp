@@ -0,0 +1,263 @@
+// FB Neo sound resampler, see burn_resample.h
+
+#include "burnint.h"
+#include "burn_resample.h"
+
+#if defined (_MSC_VER)
+#define _USE_MATH_DEFINES
+#endif
+#include <math.h>
+
+// Each output sample is made from RESAMPLE_TAPS input samples around it, weighted by a Kaiser
+// windowed sinc.  The filter is worked out for RESAMPLE_PHASES positions between two input
+// samples, and the weights for positions in between are interpolated from the two nearest.
+// When the chip runs faster than the output, the cutoff is lowered to the output's Nyquist
+// frequency, so what can't be played is filtered out rather than aliased back down.
+
+#define RESAMPLE_TAPS			16						// a multiple of 8, for the SIMD loops
+#define RESAMPLE_PHASES			256
+#define RESAMPLE_HISTORY		(RESAMPLE_TAPS / 2 - 1)	// input samples kept before the current one
+#define RESAMPLE_MAX_CHANNELS	8
+#define RESAMPLE_BETA			7.0						// Kaiser window shape
+#define RESAMPLE_CUTOFF			0.90					// of the lower Nyquist frequency
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_RESAMPLE_SSE2
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define BURN_RESAMPLE_NEON
+ #include <arm_neon.h>
+#endif
+
+struct BurnResample {
+	INT32 nChannels;
+	UINT64 nStep;						// input samples per output sample, 32.32 fixed point
+	UINT64 nPos;						// of the next output sample in pBuffer, 32.32 fixed point
+	INT32 nFill;						// input samples in pBuffer
+	INT32 nSize;						// room in pBuffer
+	INT16* pBuffer[RESAMPLE_MAX_CHANNELS];
+	INT16* pInput[RESAMPLE_MAX_CHANNELS];
+	float* pCoeffs;						// RESAMPLE_TAPS weights for each of RESAMPLE_PHASES + 1 positions
+};
+
+// Modified Bessel function of the first kind, for the Kaiser window
+static double BesselI0(double x)
+{
+	double nSum = 1.0, nTerm = 1.0;
+
+	for (INT32 k = 1; k < 32; k++) {
+		nTerm *= (x / (2.0 * k)) * (x / (2.0 * k));
+		nSum += nTerm;
+	}
+
+	return nSum;
+}
+
+static void ResampleMakeCoeffs(BurnResample* pResample, INT32 nRateIn, INT32 nRateOut)
+{
+	double fc = RESAMPLE_CUTOFF;
+	if (nRateOut < nRateIn) {
+		fc *= (double)nRateOut / nRateIn;
+	}
+
+	for (INT32 p = 0; p <= RESAMPLE_PHASES; p++) {
+		float* pCoeff = pResample->pCoeffs + p * RESAMPLE_TAPS;
+		double nFrac = (double)p / RESAMPLE_PHASES;
+		double nSum = 0.0;
+
+		for (INT32 j = 0; j < RESAMPLE_TAPS; j++) {
+			double t = (j - RESAMPLE_HISTORY) - nFrac;		// from the output sample, in input samples
+			double x = t / (RESAMPLE_TAPS / 2);
+			double w = (x * x < 1.0) ? BesselI0(RESAMPLE_BETA * sqrt(1.0 - x * x)) / BesselI0(RESAMPLE_BETA) : 0.0;
+			double s = (t == 0.0) ? 1.0 : sin(M_PI * fc * t) / (M_PI * fc * t);
+
+			pCoeff[j] = (float)(fc * s * w);
+			nSum += pCoeff[j];
+		}
+
+		// Unity gain at every position, so a steady level doesn't ripple
+		for (INT32 j = 0; j < RESAMPLE_TAPS; j++) {
+			pCoeff[j] = (float)(pCoeff[j] / nSum);
+		}
+	}
+}
+
+BurnResample* BurnResampleInit(INT32 nRateIn, INT32 nRateOut, INT32 nChannels)
+{
+	if (nChannels > RESAMPLE_MAX_CHANNELS) {
+		bprintf(PRINT_ERROR, _T("BurnResampleInit called with %d channels, only %d supported\n"), nChannels, RESAMPLE_MAX_CHANNELS);
+		nChannels = RESAMPLE_MAX_CHANNELS;
+	}
+
+	BurnResample* pResample = (BurnResample*)BurnMalloc(sizeof(BurnResample));
+	memset(pResample, 0, sizeof(BurnResample));
+
+	pResample->nChannels = nChannels;
+	pResample->nStep = ((UINT64)nRateIn << 32) / nRateOut;
+
+	// A frame's worth to start with, BurnResampleInput() makes more room if it's needed
+	pResample->nSize = nRateIn / 50 + RESAMPLE_TAPS * 2;
+	for (INT32 i = 0; i < nChannels; i++) {
+		pResample->pBuffer[i] = (INT16*)BurnMalloc(pResample->nSize * sizeof(INT16));
+	}
+
+	pResample->pCoeffs = (float*)BurnMalloc((RESAMPLE_PHASES + 1) * RESAMPLE_TAPS * sizeof(float));
+	ResampleMakeCoeffs(pResample, nRateIn, nRateOut);
+
+	BurnResampleReset(pResample);
+
+	return pResample;
+}
+
+void BurnResampleExit(BurnResample* pResample)
+{
+	if (pResample == NULL) {
+		return;
+	}
+
+	for (INT32 i = 0; i < pResample->nChannels; i++) {
+		BurnFree(pResample->pBuffer[i]);
+	}
+	BurnFree(pResample->pCoeffs);
+	BurnFree(pResample);
+}
+
+void BurnResampleReset(BurnResample* pResample)
+{
+	// Start with silence before the first sample
+	for (INT32 i = 0; i < pResample->nChannels; i++) {
+		memset(pResample->pBuffer[i], 0, pResample->nSize * sizeof(INT16));
+	}
+
+	pResample->nFill = RESAMPLE_HISTORY;
+	pResample->nPos = (UINT64)RESAMPLE_HISTORY << 32;
+}
+
+INT32 BurnResampleNeeded(BurnResample* pResample, INT32 nOut)
+{
+	if (nOut <= 0) {
+		return 0;
+	}
+
+	// The last output sample needs the input samples up to RESAMPLE_TAPS / 2 after it
+	INT32 nLast = (INT32)((pResample->nPos + (nOut - 1) * pResample->nStep) >> 32);
+	INT32 nNeed = nLast + RESAMPLE_TAPS / 2 + 1 - pResample->nFill;
+
+	return (nNeed > 0) ? nNeed : 0;
+}
+
+INT16** BurnResampleInput(BurnResample* pResample, INT32 nIn)
+{
+	if (pResample->nFill + nIn > pResample->nSize) {
+		INT32 nSize = (pResample->nFill + nIn) * 2;
+
+		for (INT32 i = 0; i < pResample->nChannels; i++) {
+			INT16* pBuffer = (INT16*)BurnMalloc(nSize * sizeof(INT16));
+			memcpy(pBuffer, pResample->pBuffer[i], pResample->nSize * sizeof(INT16));
+			memset(pBuffer + pResample->nSize, 0, (nSize - pResample->nSize) * sizeof(INT16));
+			BurnFree(pResample->pBuffer[i]);
+			pResample->pBuffer[i] = pBuffer;
+		}
+
+		pResample->nSize = nSize;
+	}
+
+	for (INT32 i = 0; i < pResample->nChannels; i++) {
+		pResample->pInput[i] = pResample->pBuffer[i] + pResample->nFill;
+	}
+
+	return pResample->pInput;
+}
+
+static inline float ResampleDot(const INT16* pSrc, const float* pCoeff)
+{
+#if defined (BURN_RESAMPLE_SSE2)
+	__m128 vSum = _mm_setzero_ps();
+
+	for (INT32 j = 0; j < RESAMPLE_TAPS; j += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i*)(pSrc + j));
+		__m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+		__m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+		vSum = _mm_add_ps(vSum, _mm_mul_ps(lo, _mm_loadu_ps(pCoeff + j + 0)));
+		vSum = _mm_add_ps(vSum, _mm_mul_ps(hi, _mm_loadu_ps(pCoeff + j + 4)));
+	}
+
+	vSum = _mm_add_ps(vSum, _mm_movehl_ps(vSum, vSum));
+	vSum = _mm_add_ss(vSum, _mm_shuffle_ps(vSum, vSum, 1));
+
+	return _mm_cvtss_f32(vSum);
+#elif defined (BURN_RESAMPLE_NEON)
+	float32x4_t vSum = vdupq_n_f32(0.0f);
+
+	for (INT32 j = 0; j < RESAMPLE_TAPS; j += 8) {
+		int16x8_t s = vld1q_s16(pSrc + j);
+		vSum = vmlaq_f32(vSum, vcvtq_f32_s32(vmovl_s16(vget_low_s16(s))), vld1q_f32(pCoeff + j + 0));
+		vSum = vmlaq_f32(vSum, vcvtq_f32_s32(vmovl_s16(vget_high_s16(s))), vld1q_f32(pCoeff + j + 4));
+	}
+
+	float32x2_t vPair = vadd_f32(vget_low_f32(vSum), vget_high_f32(vSum));
+
+	return vget_lane_f32(vpadd_f32(vPair, vPair), 0);
+#else
+	float nSum = 0.0f;
+
+	for (INT32 j = 0; j < RESAMPLE_TAPS; j++) {
+		nSum += pSrc[j] * pCoeff[j];
+	}
+
+	return nSum;
+#endif
+}
+
+void BurnResampleRun(BurnResample* pResample, INT32 nIn, INT16** pOut, INT32 nOut)
+{
+	INT32 nNeed = BurnResampleNeeded(pResample, nOut);
+
+	// The chip made less than was asked for, carry on with silence rather than old data
+	if (nIn < nNeed) {
+		INT16** pInput = BurnResampleInput(pResample, nNeed);
+		for (INT32 i = 0; i < pResample->nChannels; i++) {
+			memset(pInput[i] + nIn, 0, (nNeed - nIn) * sizeof(INT16));
+		}
+		nIn = nNeed;
+	}
+
+	pResample->nFill += nIn;
+
+	float nCoeff[RESAMPLE_TAPS];
+
+	for (INT32 n = 0; n < nOut; n++, pResample->nPos += pResample->nStep) {
+		INT32 nIndex = (INT32)(pResample->nPos >> 32) - RESAMPLE_HISTORY;
+		INT32 nPhase = (INT32)(pResample->nPos >> (32 - 8)) & (RESAMPLE_PHASES - 1);
+		float nFrac = (float)((pResample->nPos >> 8) & 0xffff) / 65536.0f;
+
+		// The weights for this position, shared by all the channels
+		const float* pCoeff0 = pResample->pCoeffs + nPhase * RESAMPLE_TAPS;
+		const float* pCoeff1 = pCoeff0 + RESAMPLE_TAPS;
+		for (INT32 j = 0; j < RESAMPLE_TAPS; j++) {
+			nCoeff[j] = pCoeff0[j] + (pCoeff1[j] - pCoeff0[j]) * nFrac;
+		}
+
+		for (INT32 i = 0; i < pResample->nChannels; i++) {
+			float nSample = ResampleDot(pResample->pBuffer[i] + nIndex, nCoeff);
+			INT32 nRound = (INT32)((nSample < 0.0f) ? (nSample - 0.5f) : (nSample + 0.5f));
+
+			pOut[i][n] = BURN_SND_CLIP(nRound);
+		}
+	}
+
+	// Drop the input that's no longer needed
+	INT32 nDrop = (INT32)(pResample->nPos >> 32) - RESAMPLE_HISTORY;
+	if (nDrop > 0) {
+		if (nDrop > pResample->nFill) {
+			nDrop = pResample->nFill;
+		}
+
+		for (INT32 i = 0; i < pResample->nChannels; i++) {
+			memmove(pResample->pBuffer[i], pResample->pBuffer[i] + nDrop, (pResample->nFill - nDrop) * sizeof(INT16));
+		}
+
+		pResample->nFill -= nDrop;
+		pResample->nPos -= (UINT64)nDrop << 32;
+	}
+}
@@ -0,0 +1,37 @@
+// FB Neo sound resampler
+//
+// Converts a sound chip's output from the rate it runs at to nBurnSoundRate with a windowed sinc
+// filter, instead of each chip interpolating between its last four samples.  The chip renders
+// straight into the resampler's input at its own rate, as many samples as it's asked for, and
+// the resampler makes the output samples from them:
+//
+//	INT32 nNeed = BurnResampleNeeded(pResample, nSegmentLength);
+//	ChipUpdate(BurnResampleInput(pResample, nNeed), nNeed);
+//	BurnResampleRun(pResample, nNeed, pOutput, nSegmentLength);
+//
+// Any segment length works, up to a whole frame at once.  Channels are kept apart (planar), so
+// the chip's own routes and volumes are applied to the output as if it ran at nBurnSoundRate.
+//
+// Nothing goes in savestates: after a load the resampler carries on from the few input samples
+// it last had, which only smooths the join.
+
+#ifndef _BURN_RESAMPLE_H
+#define _BURN_RESAMPLE_H
+
+struct BurnResample;
+
+// nChannels channels of nRateIn Hz to nRateOut Hz
+BurnResample* BurnResampleInit(INT32 nRateIn, INT32 nRateOut, INT32 nChannels);
+void BurnResampleExit(BurnResample* pResample);
+void BurnResampleReset(BurnResample* pResample);
+
+// Input samples needed before nOut samples can be made
+INT32 BurnResampleNeeded(BurnResample* pResample, INT32 nOut);
+
+// Where the chip writes its next nIn samples, one pointer per channel
+INT16** BurnResampleInput(BurnResample* pResample, INT32 nIn);
+
+// Take nIn samples written to BurnResampleInput() and make nOut samples of each channel in pOut
+void BurnResampleRun(BurnResample* pResample, INT32 nIn, INT16** pOut, INT32 nOut);
+
+#endif
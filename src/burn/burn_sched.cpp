@@ -0,0 +1,273 @@
+// FB Neo event-driven cpu scheduler, see burn_sched.h
+
+#include "burnint.h"
+#include "timer.h"
+#include "burn_sched.h"
+
+struct BurnSchedCpu {
+	cpu_core_config* pCpu;
+	INT32 nCpu;
+	INT32 nCyclesFrame;
+	INT32 nCyclesExtra;					// cycles run past the end of the last frame
+	bool bTimer;						// attached to BurnTimer
+};
+
+struct BurnSchedEvent {
+	INT32 nTime;
+	void (*pCallback)(INT32);
+	INT32 nParam;
+};
+
+static BurnSchedCpu SchedCpu[BURN_SCHED_MAX_CPUS];
+static INT32 nSchedCpus;
+
+static BurnSchedEvent SchedEvent[BURN_SCHED_MAX_EVENTS];	// every frame, sorted by time
+static INT32 nSchedEvents;
+
+static BurnSchedEvent SchedCall[BURN_SCHED_MAX_CALLS];		// waiting for the other cpus
+static INT32 nSchedCalls;
+
+static INT32 nSchedFrame;				// frame length, lines << 16
+static INT32 nSchedQuantum;
+static INT32 nSchedActive = -1;			// cpu running now
+static INT32 nSchedStop;				// earliest time the running cpu was asked to stop, or -1
+
+// Cycles a cpu has to have run by nTime
+static inline INT32 BurnSchedCycles(BurnSchedCpu* p, INT32 nTime)
+{
+	return (INT64)p->nCyclesFrame * nTime / nSchedFrame;
+}
+
+// Cycles a cpu has run this frame (cpu open)
+static inline INT32 BurnSchedDone(BurnSchedCpu* p)
+{
+	return p->nCyclesExtra + p->pCpu->totalcycles();
+}
+
+// Time a cpu has reached (cpu open)
+static inline INT32 BurnSchedTime(BurnSchedCpu* p)
+{
+	return (INT64)BurnSchedDone(p) * nSchedFrame / p->nCyclesFrame;
+}
+
+void BurnSchedInit(INT32 nLines)
+{
+	memset(SchedCpu, 0, sizeof(SchedCpu));
+	nSchedCpus = nSchedEvents = nSchedCalls = 0;
+
+	nSchedFrame = nLines << 16;
+	nSchedQuantum = 0;
+	nSchedActive = -1;
+}
+
+void BurnSchedExit()
+{
+	nSchedCpus = nSchedEvents = nSchedCalls = 0;
+	nSchedActive = -1;
+}
+
+void BurnSchedReset()
+{
+	for (INT32 i = 0; i < nSchedCpus; i++) {
+		SchedCpu[i].nCyclesExtra = 0;
+	}
+
+	nSchedCalls = 0;
+}
+
+void BurnSchedScan(INT32 nAction)
+{
+	if (nAction & ACB_DRIVER_DATA) {
+		for (INT32 i = 0; i < nSchedCpus; i++) {
+			SCAN_VAR(SchedCpu[i].nCyclesExtra);
+		}
+	}
+}
+
+static void BurnSchedAdd(cpu_core_config* pCpu, INT32 nCpu, INT32 nCyclesPerFrame, bool bTimer)
+{
+	if (nSchedCpus >= BURN_SCHED_MAX_CPUS) {
+		bprintf(PRINT_ERROR, _T("BurnSchedAddCpu: too many cpus\n"));
+		return;
+	}
+
+	BurnSchedCpu* p = &SchedCpu[nSchedCpus++];
+
+	p->pCpu = pCpu;
+	p->nCpu = nCpu;
+	p->nCyclesFrame = nCyclesPerFrame;
+	p->nCyclesExtra = 0;
+	p->bTimer = bTimer;
+}
+
+void BurnSchedAddCpu(cpu_core_config* pCpu, INT32 nCpu, INT32 nCyclesPerFrame)
+{
+	BurnSchedAdd(pCpu, nCpu, nCyclesPerFrame, false);
+}
+
+void BurnSchedAddTimerCpu(cpu_core_config* pCpu, INT32 nCpu, INT32 nCyclesPerFrame)
+{
+	BurnSchedAdd(pCpu, nCpu, nCyclesPerFrame, true);
+}
+
+void BurnSchedAddEvent(INT32 nLine, void (*pCallback)(INT32))
+{
+	if (nSchedEvents >= BURN_SCHED_MAX_EVENTS) {
+		bprintf(PRINT_ERROR, _T("BurnSchedAddEvent: too many events\n"));
+		return;
+	}
+
+	INT32 nTime = nLine << 16;
+
+	// Keep them sorted, after any already on the same line
+	INT32 i = nSchedEvents++;
+	while (i > 0 && SchedEvent[i - 1].nTime > nTime) {
+		SchedEvent[i] = SchedEvent[i - 1];
+		i--;
+	}
+
+	SchedEvent[i].nTime = nTime;
+	SchedEvent[i].pCallback = pCallback;
+	SchedEvent[i].nParam = nLine;
+}
+
+void BurnSchedSetQuantum(INT32 nLines)
+{
+	nSchedQuantum = nLines << 16;
+}
+
+void BurnSchedSync()
+{
+	if (nSchedActive < 0) {
+		return;
+	}
+
+	BurnSchedCpu* p = &SchedCpu[nSchedActive];
+
+	INT32 nTime = BurnSchedTime(p);
+	if (nSchedStop < 0 || nTime < nSchedStop) {
+		nSchedStop = nTime;
+	}
+
+	if (p->bTimer) {
+		BurnTimerUpdateEnd();
+	} else if (p->pCpu->runendsync) {
+		p->pCpu->runendsync();
+	} else {
+		p->pCpu->runend();
+	}
+}
+
+void BurnSchedSyncCall(void (*pCallback)(INT32), INT32 nParam)
+{
+	if (nSchedActive < 0 || nSchedCalls >= BURN_SCHED_MAX_CALLS) {
+		pCallback(nParam);
+		return;
+	}
+
+	BurnSchedEvent* pCall = &SchedCall[nSchedCalls++];
+
+	pCall->nTime = BurnSchedTime(&SchedCpu[nSchedActive]);
+	pCall->pCallback = pCallback;
+	pCall->nParam = nParam;
+
+	BurnSchedSync();
+}
+
+// Make the deferred calls due by nTime, in the order they were made
+static void BurnSchedDoCalls(INT32 nTime)
+{
+	INT32 nLeft = 0;
+
+	for (INT32 i = 0; i < nSchedCalls; i++) {
+		if (SchedCall[i].nTime <= nTime) {
+			SchedCall[i].pCallback(SchedCall[i].nParam);
+		} else {
+			SchedCall[nLeft++] = SchedCall[i];
+		}
+	}
+
+	nSchedCalls = nLeft;
+}
+
+void BurnSchedRunFrame()
+{
+	for (INT32 i = 0; i < nSchedCpus; i++) {
+		SchedCpu[i].pCpu->newframe();
+	}
+
+	INT32 nTime = 0;
+	INT32 nEvent = 0;
+
+	while (1) {
+		while (nEvent < nSchedEvents && SchedEvent[nEvent].nTime <= nTime) {
+			SchedEvent[nEvent].pCallback(SchedEvent[nEvent].nParam);
+			nEvent++;
+		}
+
+		BurnSchedDoCalls(nTime);
+
+		if (nTime >= nSchedFrame) {
+			break;
+		}
+
+		// Run to the next event, call or quantum
+		INT32 nNext = nSchedFrame;
+
+		if (nEvent < nSchedEvents && SchedEvent[nEvent].nTime < nNext) {
+			nNext = SchedEvent[nEvent].nTime;
+		}
+		for (INT32 i = 0; i < nSchedCalls; i++) {
+			if (SchedCall[i].nTime < nNext) {
+				nNext = SchedCall[i].nTime;
+			}
+		}
+		if (nSchedQuantum && nTime + nSchedQuantum < nNext) {
+			nNext = nTime + nSchedQuantum;
+		}
+
+		for (INT32 i = 0; i < nSchedCpus; i++) {
+			BurnSchedCpu* p = &SchedCpu[i];
+
+			p->pCpu->open(p->nCpu);
+
+			INT32 nTarget = BurnSchedCycles(p, nNext);
+
+			if (nTarget > BurnSchedDone(p)) {
+				nSchedActive = i;
+				nSchedStop = -1;
+
+				if (p->bTimer) {
+					BurnTimerUpdate(nTarget);
+				} else {
+					p->pCpu->run(nTarget - BurnSchedDone(p));
+				}
+
+				nSchedActive = -1;
+
+				// Stopped to sync, so the rest only go as far as this one did
+				if (nSchedStop >= 0 && nSchedStop < nNext) {
+					nNext = (nSchedStop > nTime) ? nSchedStop : nTime;
+				}
+			}
+
+			p->pCpu->close();
+		}
+
+		nTime = nNext;
+	}
+
+	for (INT32 i = 0; i < nSchedCpus; i++) {
+		BurnSchedCpu* p = &SchedCpu[i];
+
+		p->pCpu->open(p->nCpu);
+
+		if (p->bTimer) {
+			BurnTimerEndFrame(p->nCyclesFrame);
+		} else {
+			p->nCyclesExtra = BurnSchedDone(p) - p->nCyclesFrame;
+		}
+
+		p->pCpu->close();
+	}
+}
@@ -0,0 +1,50 @@
+// FB Neo event-driven cpu scheduler
+//
+// Instead of cutting each frame into a fixed number of slices (nInterleave) and running every cpu
+// once per slice, a driver adds its cpus and the points in the frame where something has to happen
+// (interrupts, sound rendering), and BurnSchedRunFrame() runs each cpu up to the next of those.
+// Anything a cpu does that another cpu must see at the right time (a sound latch write, an nmi)
+// goes through BurnSchedSyncCall(): the running cpu is stopped there, the others are brought up to
+// the same point, and then the callback is made.  So cpus only switch as often as the game needs.
+//
+// Time is counted in lines (nLines per frame, usually the number of scanlines).  Events and
+// deferred calls are made with no cpu open, so they must use the functions that take a cpu number
+// (SekSetIRQLine(nCPU, ...), ZetNmi(nCPU), ...).  Include after burnint.h, like timer.h.
+//
+// The cpu attached to BurnTimer is added with BurnSchedAddTimerCpu() and is run through
+// BurnTimerUpdate(), so its timers keep firing as before.
+
+#ifndef _BURN_SCHED_H
+#define _BURN_SCHED_H
+
+#define BURN_SCHED_MAX_CPUS		(8)
+#define BURN_SCHED_MAX_EVENTS	(0x400)
+#define BURN_SCHED_MAX_CALLS	(0x20)
+
+void BurnSchedInit(INT32 nLines);
+void BurnSchedExit();
+void BurnSchedReset();
+void BurnSchedScan(INT32 nAction);
+
+// Cpus run in the order they are added.  Sync calls from a cpu are seen straight away by the cpus
+// added after it; the ones before it have already run to the end of the step and see them then.
+void BurnSchedAddCpu(cpu_core_config* pCpu, INT32 nCpu, INT32 nCyclesPerFrame);
+void BurnSchedAddTimerCpu(cpu_core_config* pCpu, INT32 nCpu, INT32 nCyclesPerFrame);
+
+// pCallback(nLine) is called every frame once all cpus reach the start of nLine (nLines is the end
+// of the frame).  Events on the same line are called in the order they were added.
+void BurnSchedAddEvent(INT32 nLine, void (*pCallback)(INT32));
+
+// Run the cpus at most nLines at a time, for games that need it (0 = only switch at events and syncs)
+void BurnSchedSetQuantum(INT32 nLines);
+
+// Stop the running cpu, so the others catch up with it before it goes on
+void BurnSchedSync();
+
+// Call pCallback(nParam) once all cpus reach the running cpu's current time
+// (straight away if no cpu is running)
+void BurnSchedSyncCall(void (*pCallback)(INT32), INT32 nParam);
+
+void BurnSchedRunFrame();
+
+#endif
@@ -344,6 +344,8 @@ void BurnShiftRender()
 
 	if (!BurnShiftEnabled) return;
 
+	BurnTransferInvalidate();
+
 	INT32 xpos = shift_xpos;
 	INT32 ypos = shift_ypos;
 	INT32 color = BurnHighCol((shift_color >> 16) & 0xff, (shift_color >> 8) & 0xff, (shift_color >> 0) & 0xff, 0);
@@ -400,6 +402,8 @@ void BurnShiftRenderDoubleSize()
         set_shift_draw_position();
     }
 
+	BurnTransferInvalidate();
+
 	INT32 xpos = shift_xpos;
 	INT32 ypos = shift_ypos;
 	INT32 color = BurnHighCol((shift_color >> 16) & 0xff, (shift_color >> 8) & 0xff, (shift_color >> 0) & 0xff, 0);
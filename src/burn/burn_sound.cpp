@@ -59,3 +59,188 @@ void BurnSoundClear()
 	if (pBurnSoundOut)
 		memset(pBurnSoundOut, 0, nBurnSoundLen * 2 * sizeof(INT16));
 }
+
+// ----------------------------------------------------------------------------
+// Sound mixer
+//
+// Normally each sound chip clamps its output into pBurnSoundOut on its own, adding to what the
+// chips before it left there, so a driver with a few chips makes a pass over the sound buffer for
+// each.  Between BurnSoundMixBegin() and BurnSoundMixEnd() the chips that support it add their
+// output, with their route gains, to a float accumulator instead, and BurnSoundMixEnd() clamps
+// the lot into pBurnSoundOut once.  Chips find where to mix from the pSoundBuf the driver gave
+// them, with BurnSoundMixPos(), so drivers don't change how they call them.
+//
+// BurnSoundMixEnd() overwrites pBurnSoundOut, chips that don't support the mixer have to be
+// rendered after it.
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_SOUND_MIX_SSE2
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define BURN_SOUND_MIX_NEON
+ #include <arm_neon.h>
+#endif
+
+static float* pMixBuffer = NULL;			// stereo, interleaved
+static INT32 nMixBufferLen = 0;				// in samples
+static INT32 nMixLen = 0;
+static bool bMixing = false;
+
+void BurnSoundMixBegin()
+{
+	if (pBurnSoundOut == NULL || nBurnSoundLen <= 0) {
+		return;
+	}
+
+	if (nBurnSoundLen > nMixBufferLen) {
+		BurnFree(pMixBuffer);
+		pMixBuffer = (float*)BurnMalloc(nBurnSoundLen * 2 * sizeof(float));
+		nMixBufferLen = nBurnSoundLen;
+	}
+
+	nMixLen = nBurnSoundLen;
+	memset(pMixBuffer, 0, nMixLen * 2 * sizeof(float));
+
+	bMixing = true;
+}
+
+INT32 BurnSoundMixPos(INT16* pSoundBuf)
+{
+	if (!bMixing || pSoundBuf < pBurnSoundOut || pSoundBuf >= pBurnSoundOut + nMixLen * 2) {
+		return -1;
+	}
+
+	return (INT32)((pSoundBuf - pBurnSoundOut) >> 1);
+}
+
+// Adds nLen samples of pLeft * nVolLeft and pRight * nVolRight at sample nPos, pass the same
+// stream as pLeft and pRight for a mono chip.
+template <class T>
+static void MixAdd(INT32 nPos, const T* pLeft, const T* pRight, INT32 nLen, double nVolLeft, double nVolRight)
+{
+	if (nPos < 0 || (nVolLeft == 0.0 && nVolRight == 0.0)) {
+		return;
+	}
+
+	if (nLen > nMixLen - nPos) {
+		nLen = nMixLen - nPos;
+	}
+
+	float* pDest = pMixBuffer + nPos * 2;
+	const float fLeft = (float)nVolLeft;
+	const float fRight = (float)nVolRight;
+	INT32 i = 0;
+
+#if defined (BURN_SOUND_MIX_SSE2)
+	const __m128 vLeft = _mm_set1_ps(fLeft);
+	const __m128 vRight = _mm_set1_ps(fRight);
+
+	for (; i + 4 <= nLen; i += 4) {
+		__m128i l, r;
+		if (sizeof(T) == 2) {
+			l = _mm_loadl_epi64((const __m128i*)(pLeft + i));
+			r = _mm_loadl_epi64((const __m128i*)(pRight + i));
+			l = _mm_srai_epi32(_mm_unpacklo_epi16(l, l), 16);
+			r = _mm_srai_epi32(_mm_unpacklo_epi16(r, r), 16);
+		} else {
+			l = _mm_loadu_si128((const __m128i*)(pLeft + i));
+			r = _mm_loadu_si128((const __m128i*)(pRight + i));
+		}
+
+		__m128 fl = _mm_mul_ps(_mm_cvtepi32_ps(l), vLeft);
+		__m128 fr = _mm_mul_ps(_mm_cvtepi32_ps(r), vRight);
+
+		_mm_storeu_ps(pDest + i * 2 + 0, _mm_add_ps(_mm_loadu_ps(pDest + i * 2 + 0), _mm_unpacklo_ps(fl, fr)));
+		_mm_storeu_ps(pDest + i * 2 + 4, _mm_add_ps(_mm_loadu_ps(pDest + i * 2 + 4), _mm_unpackhi_ps(fl, fr)));
+	}
+#elif defined (BURN_SOUND_MIX_NEON)
+	for (; i + 4 <= nLen; i += 4) {
+		int32x4_t l, r;
+		if (sizeof(T) == 2) {
+			l = vmovl_s16(vld1_s16((const int16_t*)(pLeft + i)));
+			r = vmovl_s16(vld1_s16((const int16_t*)(pRight + i)));
+		} else {
+			l = vld1q_s32((const int32_t*)(pLeft + i));
+			r = vld1q_s32((const int32_t*)(pRight + i));
+		}
+
+		float32x4x2_t d = vld2q_f32(pDest + i * 2);
+		d.val[0] = vmlaq_n_f32(d.val[0], vcvtq_f32_s32(l), fLeft);
+		d.val[1] = vmlaq_n_f32(d.val[1], vcvtq_f32_s32(r), fRight);
+		vst2q_f32(pDest + i * 2, d);
+	}
+#endif
+
+	for (; i < nLen; i++) {
+		pDest[i * 2 + 0] += (float)pLeft[i] * fLeft;
+		pDest[i * 2 + 1] += (float)pRight[i] * fRight;
+	}
+}
+
+void BurnSoundMixAdd(INT32 nPos, const INT16* pLeft, const INT16* pRight, INT32 nLen, double nVolLeft, double nVolRight)
+{
+	MixAdd<INT16>(nPos, pLeft, pRight, nLen, nVolLeft, nVolRight);
+}
+
+void BurnSoundMixAdd(INT32 nPos, const INT32* pLeft, const INT32* pRight, INT32 nLen, double nVolLeft, double nVolRight)
+{
+	MixAdd<INT32>(nPos, pLeft, pRight, nLen, nVolLeft, nVolRight);
+}
+
+// For chips that work out each sample themselves
+void BurnSoundMixAddSample(INT32 nPos, INT32 nLeft, INT32 nRight)
+{
+	if (nPos < 0 || nPos >= nMixLen) {
+		return;
+	}
+
+	pMixBuffer[nPos * 2 + 0] += (float)nLeft;
+	pMixBuffer[nPos * 2 + 1] += (float)nRight;
+}
+
+void BurnSoundMixEnd(bool bDCFilter)
+{
+	if (!bMixing) {
+		return;
+	}
+
+	bMixing = false;
+
+	const float* pSrc = pMixBuffer;
+	INT16* pDest = pBurnSoundOut;
+	INT32 nLen = nMixLen * 2;
+	INT32 i = 0;
+
+	// Truncated like the (INT32) casts the chips use, then clamped by the saturating packs
+#if defined (BURN_SOUND_MIX_SSE2)
+	for (; i + 8 <= nLen; i += 8) {
+		__m128i a = _mm_cvttps_epi32(_mm_loadu_ps(pSrc + i + 0));
+		__m128i b = _mm_cvttps_epi32(_mm_loadu_ps(pSrc + i + 4));
+		_mm_storeu_si128((__m128i*)(pDest + i), _mm_packs_epi32(a, b));
+	}
+#elif defined (BURN_SOUND_MIX_NEON)
+	for (; i + 8 <= nLen; i += 8) {
+		int32x4_t a = vcvtq_s32_f32(vld1q_f32(pSrc + i + 0));
+		int32x4_t b = vcvtq_s32_f32(vld1q_f32(pSrc + i + 4));
+		vst1q_s16(pDest + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+	}
+#endif
+
+	for (; i < nLen; i++) {
+		INT32 nSample = (INT32)pSrc[i];
+		pDest[i] = BURN_SND_CLIP(nSample);
+	}
+
+	if (bDCFilter) {
+		BurnSoundDCFilter();
+	}
+}
+
+// called in burn.cpp: BurnDrvExit()
+void BurnSoundMixExit()
+{
+	BurnFree(pMixBuffer);
+	nMixBufferLen = 0;
+	nMixLen = 0;
+	bMixing = false;
+}
@@ -38,6 +38,15 @@ void BurnSoundDCFilterReset(); // called in burn.cpp: BurnDrvInit()
 
 void BurnSoundClear();
 
+// Sound mixer, see burn_sound.cpp
+void BurnSoundMixBegin();
+INT32 BurnSoundMixPos(INT16* pSoundBuf); // where pSoundBuf is in the mix, -1 if not mixing
+void BurnSoundMixAdd(INT32 nPos, const INT16* pLeft, const INT16* pRight, INT32 nLen, double nVolLeft, double nVolRight);
+void BurnSoundMixAdd(INT32 nPos, const INT32* pLeft, const INT32* pRight, INT32 nLen, double nVolLeft, double nVolRight);
+void BurnSoundMixAddSample(INT32 nPos, INT32 nLeft, INT32 nRight);
+void BurnSoundMixEnd(bool bDCFilter);
+void BurnSoundMixExit(); // called in burn.cpp: BurnDrvExit()
+
 #ifdef __ELF__
  #define Precalc _Precalc
 #endif
@@ -3,9 +3,44 @@
 
 #define CLIP(A) ((A) < -0x8000 ? -0x8000 : (A) > 0x7fff ? 0x7fff : (A))
 
+// The SSE2 and NEON loops do 8 values at a time and leave the rest to the plain loops.  Their
+// saturating packs clamp exactly like CLIP(), so the output is the same either way.
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define BURN_SOUND_SSE2
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define BURN_SOUND_NEON
+ #include <arm_neon.h>
+#endif
+
+#if defined (BURN_SOUND_SSE2)
+// 8 INT16s sign extended to two vectors of INT32s
+static inline void Unpack16(const INT16* p, __m128i& lo, __m128i& hi)
+{
+	__m128i d = _mm_loadu_si128((const __m128i*)p);
+	lo = _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16);
+	hi = _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16);
+}
+#endif
+
 void BurnSoundCopyClamp_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
 	Len *= 2;
+
+#if defined (BURN_SOUND_SSE2)
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		__m128i a = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 0)), 8);
+		__m128i b = _mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 4)), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(a, b));
+	}
+#elif defined (BURN_SOUND_NEON)
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		int32x4_t a = vshrq_n_s32(vld1q_s32(Src + 0), 8);
+		int32x4_t b = vshrq_n_s32(vld1q_s32(Src + 4), 8);
+		vst1q_s16(Dest, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+	}
+#endif
+
 	while (Len--) {
 		*Dest = CLIP((*Src >> 8));
 		Src++;
@@ -16,7 +51,25 @@ void BurnSoundCopyClamp_C(INT32 *Src, INT16 *Dest, INT32 Len)
 void BurnSoundCopyClamp_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
 	Len *= 2;
-		while (Len--) {
+
+#if defined (BURN_SOUND_SSE2)
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		__m128i lo, hi;
+		Unpack16(Dest, lo, hi);
+		__m128i a = _mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 0)), 8), lo);
+		__m128i b = _mm_add_epi32(_mm_srai_epi32(_mm_loadu_si128((__m128i*)(Src + 4)), 8), hi);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(a, b));
+	}
+#elif defined (BURN_SOUND_NEON)
+	for (; Len >= 8; Len -= 8, Src += 8, Dest += 8) {
+		int16x8_t d = vld1q_s16(Dest);
+		int32x4_t a = vaddq_s32(vshrq_n_s32(vld1q_s32(Src + 0), 8), vmovl_s16(vget_low_s16(d)));
+		int32x4_t b = vaddq_s32(vshrq_n_s32(vld1q_s32(Src + 4), 8), vmovl_s16(vget_high_s16(d)));
+		vst1q_s16(Dest, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+	}
+#endif
+
+	while (Len--) {
 		*Dest = CLIP((*Src >> 8) + *Dest);
 		Src++;
 		Dest++;
@@ -25,6 +78,19 @@ void BurnSoundCopyClamp_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 
 void BurnSoundCopyClamp_Mono_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
+#if defined (BURN_SOUND_SSE2)
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		__m128i s = _mm_srai_epi32(_mm_loadu_si128((__m128i*)Src), 8);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(_mm_unpacklo_epi32(s, s), _mm_unpackhi_epi32(s, s)));
+	}
+#elif defined (BURN_SOUND_NEON)
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		int16x4_t s = vqmovn_s32(vshrq_n_s32(vld1q_s32(Src), 8));
+		int16x4x2_t z = vzip_s16(s, s);
+		vst1q_s16(Dest, vcombine_s16(z.val[0], z.val[1]));
+	}
+#endif
+
 	while (Len--) {
 		Dest[0] = CLIP((*Src >> 8));
 		Dest[1] = CLIP((*Src >> 8));
@@ -35,6 +101,26 @@ void BurnSoundCopyClamp_Mono_C(INT32 *Src, INT16 *Dest, INT32 Len)
 
 void BurnSoundCopyClamp_Mono_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 {
+#if defined (BURN_SOUND_SSE2)
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		__m128i lo, hi;
+		Unpack16(Dest, lo, hi);
+		__m128i s = _mm_srai_epi32(_mm_loadu_si128((__m128i*)Src), 8);
+		__m128i a = _mm_add_epi32(_mm_unpacklo_epi32(s, s), lo);
+		__m128i b = _mm_add_epi32(_mm_unpackhi_epi32(s, s), hi);
+		_mm_storeu_si128((__m128i*)Dest, _mm_packs_epi32(a, b));
+	}
+#elif defined (BURN_SOUND_NEON)
+	for (; Len >= 4; Len -= 4, Src += 4, Dest += 8) {
+		int32x4_t s = vshrq_n_s32(vld1q_s32(Src), 8);
+		int32x4x2_t z = vzipq_s32(s, s);
+		int16x8_t d = vld1q_s16(Dest);
+		int32x4_t a = vaddq_s32(z.val[0], vmovl_s16(vget_low_s16(d)));
+		int32x4_t b = vaddq_s32(z.val[1], vmovl_s16(vget_high_s16(d)));
+		vst1q_s16(Dest, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+	}
+#endif
+
 	while (Len--) {
 		Dest[0] = CLIP((*Src >> 8) + Dest[0]);
 		Dest[1] = CLIP((*Src >> 8) + Dest[1]);
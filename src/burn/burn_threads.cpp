@@ -0,0 +1,275 @@
+// FB Neo worker threads, see burn_threads.h
+
+#include "burnint.h"
+
+#if defined (BURN_THREADS)
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#define BURN_THREADS_MAX		(16)
+
+static std::thread* BurnThread[BURN_THREADS_MAX];
+static INT32 nBurnThreadCount = -1;			// workers started, -1 until the pool has been made
+static std::mutex BurnThreadMutex;
+static std::condition_variable BurnThreadWake;
+static std::condition_variable BurnThreadDone;
+static bool bBurnThreadExit = false;
+static std::atomic<bool> bBurnThreadBusy(false);
+
+// The job being run
+static UINT32 nJobId = 0;
+static BurnThreadFunc pJobFunc = NULL;
+static void* pJobParam = NULL;
+static INT32 nJobCount = 0;
+static INT32 nJobChunk = 0;
+static std::atomic<INT32> nJobNext(0);
+static INT32 nJobWorkers = 0;				// workers that haven't finished the job yet
+
+static void BurnThreadRunJob()
+{
+	for (;;) {
+		INT32 nStart = nJobNext.fetch_add(nJobChunk);
+		if (nStart >= nJobCount) {
+			break;
+		}
+
+		INT32 nEnd = nStart + nJobChunk;
+		if (nEnd > nJobCount) {
+			nEnd = nJobCount;
+		}
+
+		pJobFunc(nStart, nEnd, pJobParam);
+	}
+}
+
+static void BurnThreadWorker()
+{
+	UINT32 nDoneId = 0;
+
+	std::unique_lock<std::mutex> lock(BurnThreadMutex);
+
+	for (;;) {
+		while (!bBurnThreadExit && nJobId == nDoneId) {
+			BurnThreadWake.wait(lock);
+		}
+		if (bBurnThreadExit) {
+			break;
+		}
+		nDoneId = nJobId;
+
+		lock.unlock();
+		BurnThreadRunJob();
+		lock.lock();
+
+		if (--nJobWorkers == 0) {
+			BurnThreadDone.notify_all();
+		}
+	}
+}
+
+static void BurnThreadsInit()
+{
+	INT32 nThreads = std::thread::hardware_concurrency();
+
+	if (nThreads > BURN_THREADS_MAX) {
+		nThreads = BURN_THREADS_MAX;
+	}
+
+	bBurnThreadExit = false;
+
+	for (nBurnThreadCount = 0; nBurnThreadCount < nThreads - 1; nBurnThreadCount++) {
+		BurnThread[nBurnThreadCount] = new std::thread(BurnThreadWorker);
+	}
+}
+
+INT32 BurnThreadsCount()
+{
+	if (nBurnThreadCount < 0) {
+		BurnThreadsInit();
+	}
+
+	return nBurnThreadCount + 1;
+}
+
+void BurnParallelFor(INT32 nCount, INT32 nMinChunk, BurnThreadFunc pFunc, void* pParam)
+{
+	if (nCount <= 0) {
+		return;
+	}
+
+	INT32 nThreads = BurnThreadsCount();
+
+	// Too little to split up, or called from inside a job
+	if (nThreads < 2 || nCount <= nMinChunk || bBurnThreadBusy.exchange(true)) {
+		pFunc(0, nCount, pParam);
+		return;
+	}
+
+	// A few chunks per thread, so threads that finish early can help out
+	INT32 nChunk = nCount / (nThreads * 4);
+	if (nChunk < nMinChunk) {
+		nChunk = nMinChunk;
+	}
+	if (nChunk < 1) {
+		nChunk = 1;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(BurnThreadMutex);
+
+		pJobFunc = pFunc;
+		pJobParam = pParam;
+		nJobCount = nCount;
+		nJobChunk = nChunk;
+		nJobNext = 0;
+		nJobWorkers = nBurnThreadCount;
+		nJobId++;
+	}
+	BurnThreadWake.notify_all();
+
+	BurnThreadRunJob();
+
+	{
+		std::unique_lock<std::mutex> lock(BurnThreadMutex);
+
+		while (nJobWorkers) {
+			BurnThreadDone.wait(lock);
+		}
+	}
+
+	bBurnThreadBusy = false;
+}
+
+// The thread for BurnThreadAsync(), only started when it's first used
+static std::thread* AsyncThread = NULL;
+static std::mutex AsyncMutex;
+static std::condition_variable AsyncWake;
+static std::condition_variable AsyncDone;
+static bool bAsyncExit = false;
+static bool bAsyncBusy = false;
+static BurnThreadFunc pAsyncFunc = NULL;
+static void* pAsyncParam = NULL;
+
+static void BurnThreadAsyncWorker()
+{
+	std::unique_lock<std::mutex> lock(AsyncMutex);
+
+	for (;;) {
+		while (!bAsyncExit && pAsyncFunc == NULL) {
+			AsyncWake.wait(lock);
+		}
+		if (bAsyncExit) {
+			break;
+		}
+
+		BurnThreadFunc pFunc = pAsyncFunc;
+
+		lock.unlock();
+		pFunc(0, 1, pAsyncParam);
+		lock.lock();
+
+		pAsyncFunc = NULL;
+		bAsyncBusy = false;
+		AsyncDone.notify_all();
+	}
+}
+
+void BurnThreadAsync(BurnThreadFunc pFunc, void* pParam)
+{
+	BurnThreadAsyncWait();
+
+	std::lock_guard<std::mutex> lock(AsyncMutex);
+
+	if (AsyncThread == NULL) {
+		bAsyncExit = false;
+		AsyncThread = new std::thread(BurnThreadAsyncWorker);
+	}
+
+	pAsyncFunc = pFunc;
+	pAsyncParam = pParam;
+	bAsyncBusy = true;
+	AsyncWake.notify_all();
+}
+
+void BurnThreadAsyncWait()
+{
+	std::unique_lock<std::mutex> lock(AsyncMutex);
+
+	while (bAsyncBusy) {
+		AsyncDone.wait(lock);
+	}
+}
+
+static void BurnThreadAsyncExit()
+{
+	if (AsyncThread == NULL) {
+		return;
+	}
+
+	BurnThreadAsyncWait();
+
+	{
+		std::lock_guard<std::mutex> lock(AsyncMutex);
+		bAsyncExit = true;
+	}
+	AsyncWake.notify_all();
+
+	AsyncThread->join();
+	delete AsyncThread;
+	AsyncThread = NULL;
+}
+
+void BurnThreadsExit()
+{
+	BurnThreadAsyncExit();
+
+	if (nBurnThreadCount < 0) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(BurnThreadMutex);
+		bBurnThreadExit = true;
+	}
+	BurnThreadWake.notify_all();
+
+	for (INT32 i = 0; i < nBurnThreadCount; i++) {
+		BurnThread[i]->join();
+		delete BurnThread[i];
+		BurnThread[i] = NULL;
+	}
+
+	nBurnThreadCount = -1;
+}
+
+#else
+
+INT32 BurnThreadsCount()
+{
+	return 1;
+}
+
+void BurnParallelFor(INT32 nCount, INT32 /*nMinChunk*/, BurnThreadFunc pFunc, void* pParam)
+{
+	if (nCount > 0) {
+		pFunc(0, nCount, pParam);
+	}
+}
+
+void BurnThreadAsync(BurnThreadFunc pFunc, void* pParam)
+{
+	pFunc(0, 1, pParam);
+}
+
+void BurnThreadAsyncWait()
+{
+}
+
+void BurnThreadsExit()
+{
+}
+
+#endif
@@ -0,0 +1,41 @@
+// FB Neo worker threads
+//
+// A small pool of worker threads for splitting independent work (decoding tiles, drawing bands
+// of the screen) across cores.  The calling thread takes part in the work, so the pool is one
+// thread smaller than the number of cores.  There's also one thread for running a job in the
+// background (pipelined drawing).  Without thread support in the C++ library the work is just
+// done on the calling thread.
+
+#ifndef _BURN_THREADS_H
+#define _BURN_THREADS_H
+
+#include <cstddef>
+
+#if defined (_MSC_VER) || defined (_GLIBCXX_HAS_GTHREADS) || defined (_LIBCPP_VERSION)
+ #define BURN_THREADS
+#endif
+
+// For state that each thread drawing a band needs its own copy of
+#if defined (BURN_THREADS) && defined (_MSC_VER) && (_MSC_VER < 1900)
+ #define BURN_THREAD_LOCAL	__declspec(thread)
+#elif defined (BURN_THREADS)
+ #define BURN_THREAD_LOCAL	thread_local
+#else
+ #define BURN_THREAD_LOCAL
+#endif
+
+typedef void (*BurnThreadFunc)(INT32 nStart, INT32 nEnd, void* pParam);
+
+// Call pFunc on ranges of [0, nCount) spread over the pool, in chunks of at least nMinChunk, and
+// return when they're all done.  Calls from inside pFunc run on the calling thread.
+void BurnParallelFor(INT32 nCount, INT32 nMinChunk, BurnThreadFunc pFunc, void* pParam);
+
+// Call pFunc(0, 1, pParam) on a thread of its own and return straight away, BurnThreadAsyncWait()
+// waits for it to finish.  There's one of these, so a second call waits for the first to be done.
+void BurnThreadAsync(BurnThreadFunc pFunc, void* pParam);
+void BurnThreadAsyncWait();
+
+INT32 BurnThreadsCount();				// threads BurnParallelFor() can use, including the caller
+void BurnThreadsExit();
+
+#endif
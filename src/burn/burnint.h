@@ -14,6 +14,11 @@
 
 #include "burn.h"
 #include "burn_sound.h"
+#include "burn_resample.h"
+#include "burn_profile.h"
+#include "burn_cache.h"
+#include "burn_idle.h"
+#include "burn_threads.h"
 #include "joyprocess.h"
 
 #ifdef LSB_FIRST
@@ -159,6 +164,8 @@ struct cpu_core_config {
 
 	UINT64 nMemorySize;		// how large is our memory range?
 	UINT32 nAddressXor;		// fix endianness for some cpus
+
+	void (*runendsync)();	// end run, counting only the cycles run (NULL if runend already does)
 };
 
 void CpuCheatRegister(INT32 type, cpu_core_config *config);
@@ -647,6 +647,12 @@ static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 up
 	nCpsCodeLen = length;
 	UINT16 *dec = (UINT16*)CpsCode;
 
+	UINT32 nSrcCrc = bBurnDecryptCache ? BurnCacheCrc(0, CpsRom, length) : 0;
+
+	if (BurnCacheLoad(_T("code"), nSrcCrc, CpsCode, length) == 0) {
+		return;
+	}
+
 	INT32 i;
 	UINT32 key1[4];
 	struct optimised_sbox sboxes1[4*4];
@@ -736,6 +742,8 @@ static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 up
 			}
 		}
 	}
+
+	BurnCacheSave(_T("code"), nSrcCrc, CpsCode, length);
 #if 0
 	memory_set_decrypted_region(0, 0x000000, length - 1, dec);
 	m68k_set_encrypted_opcode_range(0,0,length);
@@ -500,6 +500,8 @@ static void DoDraw(INT32 Recalc)
 
 INT32 CpsDraw()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_DRAW);
+
 	DoDraw(CpsRecalcPal);
 
 	CpsRecalcPal = 0;
@@ -508,6 +510,8 @@ INT32 CpsDraw()
 
 INT32 CpsRedraw()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_DRAW);
+
 	DoDraw(1);
 
 	CpsRecalcPal = 0;
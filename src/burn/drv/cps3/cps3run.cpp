@@ -268,11 +268,19 @@ static void cps3_decrypt_game(void)
 {
 	UINT32 * coderegion = (UINT32 *)RomGame;
 	UINT32 * decrypt_coderegion = (UINT32 *)RomGame_D;
+
+	UINT32 nSrcCrc = bBurnDecryptCache ? BurnCacheCrc(0, RomGame, 0x1000000) : 0;
+
+	if (BurnCacheLoad(_T("code"), nSrcCrc, RomGame_D, 0x1000000) == 0) {
+		return;
+	}
 	
 	for (INT32 i=0; i<0x1000000; i+=4) {
 		UINT32 xormask = cps3_mask(i + 0x06000000, cps3_key1, cps3_key2);
 		decrypt_coderegion[i/4] = coderegion[i/4] ^ xormask;
 	}
+
+	BurnCacheSave(_T("code"), nSrcCrc, RomGame_D, 0x1000000);
 }
 
 
@@ -1162,6 +1170,10 @@ INT32 cps3Init()
 		Sh2Init(1);
 		Sh2Open(0);
 
+#ifdef SH2_X64_DRC
+		Sh2UseRecompiler(bBurnSh2Recompiler);
+#endif
+
 #ifdef SPEED_HACK
 		cps3speedhack = 1;
 #endif
@@ -1722,6 +1734,8 @@ static INT32 WideScreenFrameDelay = 0;
 
 INT32 DrvCps3Draw()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_DRAW);
+
 	INT32 bg_drawn[4] = { 0, 0, 0, 0 };
 
 	UINT32 fullscreenzoom = RamVReg[ 6 * 4 + 3 ] & 0xff;
@@ -140,6 +140,8 @@ void cps3SndExit()
 
 void cps3SndUpdate()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_CPS3SND);
+
 	if (!pBurnSoundOut) {
 		// TODO: ???
 		// chip->key = 0;
@@ -2932,6 +2932,8 @@ static void mixDualAlphaSprites(INT32 mixAlphaTilemap, INT32 drawAlphaTilemap)
 		break;
 	}
 
+	BurnTransferInvalidate(); // drawn on top of pBurnDraw
+
 	/* Mix sprites into main bitmap, based on priority & alpha */
 	for (INT32 y=0; y<nScreenHeight; y++) {
 		UINT8* tilemapPri=deco16_prio_map + (y * 512);
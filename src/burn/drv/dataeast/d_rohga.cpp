@@ -1718,6 +1718,8 @@ static inline UINT32 alpha_blend(UINT32 d, UINT32 s, UINT32 p)
 
 static void mix_alpha_tilemap()
 {
+	BurnTransferInvalidate(); // drawn on top of pBurnDraw
+
 	UINT16 *src0 = tempdraw[0];
 	UINT32 *dest = (UINT32*)pBurnDraw;
 	UINT8 *prio = deco16_prio_map;
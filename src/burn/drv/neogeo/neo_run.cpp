@@ -762,9 +762,19 @@ static INT32 LoadRoms()
 	}
 	NeoZ80ROMActive = NeoZ80ROM[nNeoActiveSlot];
 
-	BurnLoadRom(NeoZ80ROMActive, pInfo->nSoundOffset, 1);
 	if (BurnDrvGetHardwareCode() & HARDWARE_SNK_ENCRYPTED_M1) {
-		neogeo_cmc50_m1_decrypt();
+		BurnLoadRom(NeoZ80ROMActive, pInfo->nSoundOffset, 1);
+		UINT32 nSrcCrc = bBurnDecryptCache ? BurnCacheCrc(0, NeoZ80ROMActive, 0x080000) : 0;
+
+		if (BurnCacheLoad(_T("m1"), nSrcCrc, NeoZ80ROMActive, 0x080000)) {
+			if (bBurnDecryptCache) {
+				BurnLoadRom(NeoZ80ROMActive, pInfo->nSoundOffset, 1);	// A bad cache file may have been read over it
+			}
+			neogeo_cmc50_m1_decrypt();
+			BurnCacheSave(_T("m1"), nSrcCrc, NeoZ80ROMActive, 0x080000);
+		}
+	} else {
+		BurnLoadRom(NeoZ80ROMActive, pInfo->nSoundOffset, 1);
 	}
 
 	if (NeoCallbackActive && NeoCallbackActive->pInitialise) {
@@ -4481,6 +4491,8 @@ INT32 NeoExit()
 
 INT32 NeoRender()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_DRAW);
+
 	NeoUpdatePalette();							// Update the palette
 	NeoClearScreen();
 
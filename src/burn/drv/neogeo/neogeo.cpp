@@ -66,6 +66,40 @@ static void NeoPCBDataDecrypt(UINT8* dst, INT32 size)
 	}
 }
 
+// Load the i-th pair of encrypted sprite ROMs (into pBuf2 for the PCBs, pBuf1 otherwise), returns
+// nCrc continued over what was loaded, if the decrypted ROM cache is on
+static UINT32 NeoLoadSpritePair(INT32 nOffset, INT32 i, UINT8* pBuf1, UINT8* pBuf2, UINT32 nRomSize, UINT32 nCrc)
+{
+	if ((BurnDrvGetHardwareCode() & HARDWARE_PUBLIC_MASK) == HARDWARE_SNK_DEDICATED_PCB) {
+		if (nRomSize == 0x02000000) {
+			
+			// The ROM chips are 32-bit
+
+			BurnLoadRom(pBuf2 + 0 * nRomSize, nOffset +     (i << 1), 1);
+			BurnLoadRom(pBuf2 + 1 * nRomSize, nOffset + 1 + (i << 1), 1);
+		} else {
+
+			// The ROM chips are 16-bit and need to be interleaved
+
+			BurnLoadRom(pBuf1, nOffset +     (i << 1), 1);
+			for (UINT32 j = 0; j < nRomSize / 2; j++) {
+				((UINT16*)pBuf2)[(j << 1) + 0] = ((UINT16*)pBuf1)[j];
+			}
+			BurnLoadRom(pBuf1, nOffset + 1 + (i << 1), 1);
+			for (UINT32 j = 0; j < nRomSize / 2; j++) {
+				((UINT16*)pBuf2)[(j << 1) + 1] = ((UINT16*)pBuf1)[j];
+			}
+		}
+
+		return bBurnDecryptCache ? BurnCacheCrc(nCrc, pBuf2, nRomSize * 2) : 0;
+	}
+
+	BurnLoadRom(pBuf1 + 0, nOffset +     (i << 1), 2);
+	BurnLoadRom(pBuf1 + 1, nOffset + 1 + (i << 1), 2);
+
+	return bBurnDecryptCache ? BurnCacheCrc(nCrc, pBuf1, nRomSize * 2) : 0;
+}
+
 // This function loads and pre-processes the sprite data
 INT32 NeoLoadSprites(INT32 nOffset, INT32 nNum, UINT8* pDest, UINT32 nSpriteSize)
 {
@@ -77,6 +111,7 @@ INT32 NeoLoadSprites(INT32 nOffset, INT32 nNum, UINT8* pDest, UINT32 nSpriteSize
 
 		UINT8* pBuf1 = NULL;
 		UINT8* pBuf2 = NULL;
+		UINT32 nSrcCrc = 0;
 
 //		double dProgress = 1.0 / ((double)((nSpriteSize > 0x04000000) ? 0x05000000 : nSpriteSize) / 0x400000 * 1.5);
 
@@ -105,56 +140,52 @@ INT32 NeoLoadSprites(INT32 nOffset, INT32 nNum, UINT8* pDest, UINT32 nSpriteSize
 			}
 		}
 
-		for (INT32 i = 0; i < (nNum >> 1); i++) {
-			if ((BurnDrvGetHardwareCode() & HARDWARE_PUBLIC_MASK) == HARDWARE_SNK_DEDICATED_PCB) {
-				if (nRomSize == 0x02000000) {
-					
-					// The ROM chips are 32-bit
+		bool bCached = false;
 
-					BurnLoadRom(pBuf2 + 0 * nRomSize, nOffset +     (i << 1), 1);
-					BurnLoadRom(pBuf2 + 1 * nRomSize, nOffset + 1 + (i << 1), 1);
-				} else {
-
-					// The ROM chips are 16-bit and need to be interleaved
+		if (BurnCacheCheck(_T("sprites"), nSpriteSize) == 0) {
+			// The ROMs are still loaded, so a cache file made from different ones isn't used
+			for (INT32 i = 0; i < (nNum >> 1); i++) {
+				nSrcCrc = NeoLoadSpritePair(nOffset, i, pBuf1, pBuf2, nRomSize, nSrcCrc);
+			}
 
-					BurnLoadRom(pBuf1, nOffset +     (i << 1), 1);
-					for (UINT32 j = 0; j < nRomSize / 2; j++) {
-						((UINT16*)pBuf2)[(j << 1) + 0] = ((UINT16*)pBuf1)[j];
-					}
-					BurnLoadRom(pBuf1, nOffset + 1 + (i << 1), 1);
-					for (UINT32 j = 0; j < nRomSize / 2; j++) {
-						((UINT16*)pBuf2)[(j << 1) + 1] = ((UINT16*)pBuf1)[j];
-					}
-				}
+			if (BurnCacheLoad(_T("sprites"), nSrcCrc, pDest, nSpriteSize) == 0) {
+				bCached = true;
 			} else {
-				BurnLoadRom(pBuf1 + 0, nOffset +     (i << 1), 2);
-				BurnLoadRom(pBuf1 + 1, nOffset + 1 + (i << 1), 2);
+				nSrcCrc = 0;
 			}
+		}
 
-//			BurnUpdateProgress(0.0, _T("Decrypting graphics...")/*, BST_DECRYPT_GRA*/ , 0);
-			BurnUpdateProgress(1.0 / ((double)(nSpriteSize/0x800000) * 8.0 / (nRomSize / 0x400000) / 3.0), _T("Decrypting graphics..."), 0);
+		if (!bCached) {
+			for (INT32 i = 0; i < (nNum >> 1); i++) {
+				nSrcCrc = NeoLoadSpritePair(nOffset, i, pBuf1, pBuf2, nRomSize, nSrcCrc);
+
+//				BurnUpdateProgress(0.0, _T("Decrypting graphics...")/*, BST_DECRYPT_GRA*/ , 0);
+				BurnUpdateProgress(1.0 / ((double)(nSpriteSize/0x800000) * 8.0 / (nRomSize / 0x400000) / 3.0), _T("Decrypting graphics..."), 0);
+
+				if ((i * nRomSize * 2) < 0x04000000) {
+					for (UINT32 j = 0; j < nRomSize * 2; j += 0x400000) {
+						if ((BurnDrvGetHardwareCode() & HARDWARE_PUBLIC_MASK) == HARDWARE_SNK_DEDICATED_PCB) {
+//							BurnUpdateProgress(dProgress / 2.0, NULL/*, 0*/, 0);
+							(BurnDrvGetHardwareCode() & HARDWARE_SNK_KOF2K3) ? NeoKOFAddressDecrypt(pBuf2, pBuf1, j, j + 0x400000) : NeoSVCAddressDecrypt(pBuf2, pBuf1, j, j + 0x400000);
+							NeoPCBDataDecrypt(pBuf1 + j, 0x400000);
+						}
+//						BurnUpdateProgress(dProgress, NULL/*, 0*/, 0);
+						NeoCMCDecrypt(nNeoProtectionXor, pDest, pBuf1 + j, i * (nRomSize * 2) + j, 0x400000, nSpriteSize);
+					}
+				} else {
+					// The kof2k3 PCB has 96MB of graphics ROM, however the last 16MB are unused, and the protection/decryption hardware does not see them
 
-			if ((i * nRomSize * 2) < 0x04000000) {
-				for (UINT32 j = 0; j < nRomSize * 2; j += 0x400000) {
-					if ((BurnDrvGetHardwareCode() & HARDWARE_PUBLIC_MASK) == HARDWARE_SNK_DEDICATED_PCB) {
+					for (UINT32 j = 0; j < nRomSize; j += 0x400000) {
 //						BurnUpdateProgress(dProgress / 2.0, NULL/*, 0*/, 0);
-						(BurnDrvGetHardwareCode() & HARDWARE_SNK_KOF2K3) ? NeoKOFAddressDecrypt(pBuf2, pBuf1, j, j + 0x400000) : NeoSVCAddressDecrypt(pBuf2, pBuf1, j, j + 0x400000);
+						NeoKOFAddressDecrypt(pBuf2, pBuf1, j, j + 0x400000);
 						NeoPCBDataDecrypt(pBuf1 + j, 0x400000);
+//						BurnUpdateProgress(dProgress, NULL, /*0,*/ 0);
+						NeoCMCDecrypt(nNeoProtectionXor, pDest + 0x4000000, pBuf1 + j, j, 0x400000, 0x1000000);
 					}
-//					BurnUpdateProgress(dProgress, NULL/*, 0*/, 0);
-					NeoCMCDecrypt(nNeoProtectionXor, pDest, pBuf1 + j, i * (nRomSize * 2) + j, 0x400000, nSpriteSize);
-				}
-			} else {
-				// The kof2k3 PCB has 96MB of graphics ROM, however the last 16MB are unused, and the protection/decryption hardware does not see them
-
-				for (UINT32 j = 0; j < nRomSize; j += 0x400000) {
-//					BurnUpdateProgress(dProgress / 2.0, NULL/*, 0*/, 0);
-					NeoKOFAddressDecrypt(pBuf2, pBuf1, j, j + 0x400000);
-					NeoPCBDataDecrypt(pBuf1 + j, 0x400000);
-//					BurnUpdateProgress(dProgress, NULL, /*0,*/ 0);
-					NeoCMCDecrypt(nNeoProtectionXor, pDest + 0x4000000, pBuf1 + j, j, 0x400000, 0x1000000);
 				}
 			}
+
+			BurnCacheSave(_T("sprites"), nSrcCrc, pDest, nSpriteSize);
 		}
 
 		BurnFree(pBuf2);
@@ -177,6 +177,11 @@ void install_protection_asic27a_kovsh()
 
 	Arm7Init(0);
 	Arm7Open(0);
+
+#ifdef ARM7_X64_DRC
+	Arm7UseRecompiler(bBurnArm7Recompiler);
+#endif
+
 	Arm7MapMemory(PGMARMROM,	0x00000000, 0x00003fff, MAP_ROM);
 	Arm7MapMemory(PGMARMRAM0,	0x10000000, 0x100003ff, MAP_RAM);
 	Arm7MapMemory(PGMARMRAM2,	0x50000000, 0x500003ff, MAP_RAM);
@@ -261,6 +266,11 @@ void install_protection_asic27a_kovshp()
 
 	Arm7Init(0);
 	Arm7Open(0);
+
+#ifdef ARM7_X64_DRC
+	Arm7UseRecompiler(bBurnArm7Recompiler);
+#endif
+
 	Arm7MapMemory(PGMARMROM,	0x00000000, 0x00003fff, MAP_ROM);
 	Arm7MapMemory(PGMARMRAM0,	0x10000000, 0x100003ff, MAP_RAM);
 	Arm7MapMemory(PGMARMRAM2,	0x50000000, 0x500003ff, MAP_RAM);
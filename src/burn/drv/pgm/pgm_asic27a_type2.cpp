@@ -141,6 +141,11 @@ void install_protection_asic27a_martmast()
 
 	Arm7Init(0);
 	Arm7Open(0);
+
+#ifdef ARM7_X64_DRC
+	Arm7UseRecompiler(bBurnArm7Recompiler);
+#endif
+
 	Arm7MapMemory(PGMARMROM,	0x00000000, 0x00003fff, MAP_ROM);
 	Arm7MapMemory(PGMUSER0,		0x08000000, 0x08000000+(nPGMExternalARMLen-1), MAP_ROM);
 	Arm7MapMemory(PGMARMRAM0,	0x10000000, 0x100003ff, MAP_RAM);
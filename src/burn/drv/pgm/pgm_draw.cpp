@@ -1020,6 +1020,8 @@ static void pgmBlendCopy()
 
 INT32 pgmDraw()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_DRAW);
+
 	if (enable_blending) nPgmPalRecalc = 1; // force recalc.
 
 	if (nPgmPalRecalc) {
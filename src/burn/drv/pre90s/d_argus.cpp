@@ -1177,6 +1177,8 @@ static void DrvPaletteRecalc()
 
 static void draw_sprite_blend(INT32 bgmask, INT32 code, INT32 sx, INT32 sy, INT32 flipx, INT32 flipy, INT32 color, INT32 depth, INT32 mask, INT32 color_offset, UINT8 *gfx)
 {
+	BurnTransferInvalidate(); // drawn on top of pBurnDraw
+
 	gfx += (code * 16 * 16);
 
 	color = (color << depth) + color_offset;
@@ -769,6 +769,10 @@ static INT32 DrvInit(INT32 (*LoadCallback)(), INT32 type, INT32 gfx_max, INT32 g
 		Sh2SetWriteLongHandler(0,		psx_write_long);
 	}
 
+#ifdef SH2_X64_DRC
+	Sh2UseRecompiler(bBurnSh2Recompiler);
+#endif
+
 	cpu_rate = 28636350;
 
 	Sh2MapHandler(1, 0x06000000 | speedhack_address, 0x0600ffff | speedhack_address, MAP_ROM);
@@ -629,6 +629,8 @@ static void postlineblend()
 
 INT32 PsikyoshDraw()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_DRAW);
+
 	{
 		for (INT32 i = 0; i < 0x5000 / 4; i++) {
 			pBurnDrvPalette[i] = pPsikyoshPalRAM[i] >> 8;
@@ -400,6 +400,8 @@ static INT32 DrvInit()
 	GenericTilemapSetTransparent(0, 0);
 	GenericTilemapSetTransparent(1, 0);
 	GenericTilemapSetOffsets(TMAP_GLOBAL, 0, -16);
+	GenericTilemapUseCache(0);
+	GenericTilemapUseCache(1);
 
 	DrvDoReset();
 
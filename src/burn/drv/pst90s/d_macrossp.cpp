@@ -862,6 +862,8 @@ static void render_sprite(INT32 code, INT32 color, INT32 sx, INT32 sy, INT32 fx,
 	if (DrvTransTab[0][code & 0xffff])
 		return;
 
+	BurnTransferInvalidate(); // drawn on top of pBurnDraw
+
 	UINT8 *dest = pBurnDraw;
 	UINT16 *bg = pTransDraw;
 	UINT8 *gfx = DrvGfxROM0;
@@ -6,6 +6,7 @@
 #include "z80_intf.h"
 #include "burn_ym2151.h"
 #include "msm6295.h"
+#include "burn_sched.h"
 
 static UINT8 *AllMem;
 static UINT8 *MemEnd;
@@ -39,6 +40,8 @@ static UINT8  DrvJoy2[16];
 static UINT8  DrvDips[4];
 static UINT16 DrvInputs[4];
 
+static INT32 nSoundBufferPos;
+
 static UINT8 *soundlatch;
 
 static struct BurnInputInfo MugsmashInputList[] = {
@@ -170,6 +173,11 @@ static void palette_write(INT32 offset)
 	DrvPalette[offset >> 1] = BurnHighCol(r, g, b, 0);
 }
 
+static void mugsmash_sound_nmi(INT32)
+{
+	ZetNmi(0);
+}
+
 void __fastcall mugsmash_write_byte(UINT32 address, UINT8 data)
 {
 	if (address >= 0x100000 && address <= 0x1005ff) {
@@ -187,7 +195,7 @@ void __fastcall mugsmash_write_byte(UINT32 address, UINT8 data)
 	{
 		case 0x140002:
 		case 0x140003:
-			ZetNmi();
+			BurnSchedSyncCall(mugsmash_sound_nmi, 0);
 		case 0x140000:
 		case 0x140001:
 		case 0x140004:
@@ -230,7 +238,7 @@ void __fastcall mugsmash_write_word(UINT32 address, UINT16 data)
 		return;
 
 		case 0x140002:
-			ZetNmi();
+			BurnSchedSyncCall(mugsmash_sound_nmi, 0);
 		case 0x140000:
 		case 0x140004:
 		case 0x140006:
@@ -356,12 +364,29 @@ static INT32 DrvDoReset()
 	MSM6295Reset(0);
 	BurnYM2151Reset();
 
+	BurnSchedReset();
+
 	return 0;
 }
 
 static void MugsmashYM2151IrqHandler(INT32 nStatus)
 {
-	ZetSetIRQLine(0, (nStatus) ? CPU_IRQSTATUS_ACK : CPU_IRQSTATUS_NONE);
+	ZetSetIRQLine(0, 0, (nStatus) ? CPU_IRQSTATUS_ACK : CPU_IRQSTATUS_NONE);
+}
+
+// Called at the end of each tenth of the frame
+static void DrvSchedEvent(INT32 nLine)
+{
+	if (pBurnSoundOut) {
+		INT32 nSegment = nBurnSoundLen / 10;
+		BurnYM2151Render(pBurnSoundOut + (nSoundBufferPos << 1), nSegment);
+		MSM6295Render(0, pBurnSoundOut + (nSoundBufferPos << 1), nSegment);
+		nSoundBufferPos += nSegment;
+	}
+
+	if (nLine == 10) {
+		SekSetIRQLine(0, 6, CPU_IRQSTATUS_AUTO);
+	}
 }
 
 static INT32 DrvInit()
@@ -431,6 +456,13 @@ static INT32 DrvInit()
 	MSM6295Init(0, 1122000 / 132, 1);
 	MSM6295SetRoute(0, 0.50, BURN_SND_ROUTE_BOTH);
 
+	BurnSchedInit(10);
+	BurnSchedAddCpu(&SekConfig, 0, 12000000 / 60);
+	BurnSchedAddCpu(&ZetConfig, 0, 4000000 / 60);
+	for (INT32 i = 1; i <= 10; i++) {
+		BurnSchedAddEvent(i, DrvSchedEvent);
+	}
+
 	DrvDoReset();
 
 	return 0;
@@ -446,6 +478,8 @@ static INT32 DrvExit()
 	MSM6295Exit();
 	BurnYM2151Exit();
 
+	BurnSchedExit();
+
 	BurnFree (AllMem);
 
 	return 0;
@@ -531,28 +565,9 @@ static INT32 DrvFrame()
 		}
 	}
 
-	INT32 nInterleave = 10;
-	INT32 nCyclesTotal[2] = { 12000000 / 60, 4000000 / 60 };
-	INT32 nCyclesDone[2] = { 0, 0 };
-	INT32 nSoundBufferPos = 0;
+	nSoundBufferPos = 0;
 
-	SekOpen(0);
-	ZetOpen(0);
-
-	for (INT32 i = 0; i < nInterleave; i++)
-	{
-		nCyclesDone[0] += SekRun(((i + 1) * nCyclesTotal[0] / nInterleave) - nCyclesDone[0]);
-		if (i == (nInterleave - 1)) SekSetIRQLine(6, CPU_IRQSTATUS_AUTO);
-
-		nCyclesDone[1] += ZetRun(((i + 1) * nCyclesTotal[1] / nInterleave) - nCyclesDone[1]);
-
-		if (pBurnSoundOut) {
-			INT32 nSegment = nBurnSoundLen / nInterleave;
-			BurnYM2151Render(pBurnSoundOut + ((nSegment * i) << 1), nSegment);
-			MSM6295Render(0, pBurnSoundOut + ((nSegment * i) << 1), nSegment);
-			nSoundBufferPos += nSegment;
-		}
-	}
+	BurnSchedRunFrame();
 
 	if (pBurnSoundOut) {
 		INT32 nSegment = nBurnSoundLen - nSoundBufferPos;
@@ -562,9 +577,6 @@ static INT32 DrvFrame()
 		}
 	}
 
-	ZetClose();
-	SekClose();
-
 	if (pBurnDraw) {
 		DrvDraw();
 	}
@@ -594,6 +606,8 @@ static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
 
 		BurnYM2151Scan(nAction, pnMin);
 		MSM6295Scan(nAction, pnMin);
+
+		BurnSchedScan(nAction);
 	}
 
 	return 0;
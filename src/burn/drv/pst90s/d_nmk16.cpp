@@ -5142,6 +5142,8 @@ static void draw_screen_yflip()
 {
 	if (!screen_flip_y) return;
 
+	BurnTransferInvalidate(); // pBurnDraw is flipped in place
+
 	UINT16 *tmp = (UINT16*)pBurnDraw; // :D
 	UINT16 *src1 = pTransDraw;
 	UINT16 *src2 = pTransDraw + (nScreenHeight-1) * nScreenWidth;
@@ -630,6 +630,8 @@ static INT32 DrvFrame()
 
 	VezOpen(0);
 
+	BurnSoundMixBegin();
+
 	for (INT32 i = 0; i < nInterleave; i++) {
     	INT32 nCurrentCPU;
 		INT32 nNext;
@@ -681,6 +683,8 @@ static INT32 DrvFrame()
 		}
 	}
 
+	BurnSoundMixEnd(false);
+
 	VezClose();
 	SekClose();
 
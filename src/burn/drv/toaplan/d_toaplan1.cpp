@@ -35,6 +35,13 @@ static UINT16 *pTempDraw;
 static UINT32 *DrvPalette;
 static UINT8 DrvRecalc;
 
+// copies of what's drawn, for drawing on the render thread (see BurnVideoPipelineInit())
+static UINT8 *DrawVidRAM;
+static UINT8 *DrawSprBuf;
+static UINT8 *DrawSprSizeBuf;
+static UINT32 *DrawPalette;
+static UINT16 draw_sprite_flipscreen;
+
 static UINT16 sprite_flipscreen;
 static UINT8 flipscreen;
 static UINT8 interrupt_enable;
@@ -1712,7 +1719,7 @@ static UINT8 __fastcall demonwld_sound_read_port(UINT16 port)
 }
 
 #define tilemap_cb(layer)					\
-	UINT16 *ram = (UINT16*)(DrvVidRAM + (layer*0x4000));	\
+	UINT16 *ram = (UINT16*)(DrawVidRAM + (layer*0x4000));	\
 	UINT16 attr = ram[offs * 2 + 0];			\
 	UINT16 code = ram[offs * 2 + 1];			\
 	UINT8 color = attr & 0x3f;				\
@@ -1810,6 +1817,11 @@ static INT32 MemIndex()
 
 	pTempDraw	= (UINT16*)Next; Next += 512 * 512 * sizeof(short);
 
+	DrawVidRAM	= Next; Next += 0x010000;
+	DrawSprBuf	= Next; Next += 0x001000;
+	DrawSprSizeBuf	= Next; Next += 0x000080;
+	DrawPalette	= (UINT32*)Next; Next += 0x0800 * sizeof(UINT32);
+
 	AllRam		= Next;
 
 	Drv68KRAM	= Next; Next += 0x008000;
@@ -2029,6 +2041,10 @@ static void common_sound_init(void (__fastcall *write_port)(UINT16, UINT8), UINT
 	BurnYM3812SetRoute(0, BURN_SND_YM3812_ROUTE, 1.00, BURN_SND_ROUTE_BOTH);
 }
 
+static void DrvSnapshot();
+static void DrvRender();
+static void RallybikRender();
+
 static void configure_graphics(INT32 xoffs, INT32 yoffs, INT32 adjust_sprite_y)
 {
 	GenericTilesInit();
@@ -2047,6 +2063,8 @@ static void configure_graphics(INT32 xoffs, INT32 yoffs, INT32 adjust_sprite_y)
 	GenericTilemapSetOffsets(3, -(xoffs+0), -(256+1+yoffs));
 
 	sprite_y_adjust = adjust_sprite_y;
+
+	BurnVideoPipelineInit(DrvSnapshot, DrvRender, DrawPalette);
 }
 
 static INT32 RallybikInit()
@@ -2073,6 +2091,7 @@ static INT32 RallybikInit()
 	common_sound_init(rallybik_sound_write_port, rallybik_sound_read_port);
 
 	configure_graphics(13, 16, 0);
+	BurnVideoPipelineInit(DrvSnapshot, RallybikRender, DrawPalette);
 
 	DrvDoReset();
 
@@ -2348,12 +2367,35 @@ static void DrvPaletteUpdate()
 	}
 }
 
+static void DrvSnapshot()
+{
+	if (DrvRecalc) {
+		DrvPaletteUpdate();
+		DrvRecalc = 0;
+	}
+
+	for (INT32 i = 0; i < 4; i++) {
+		GenericTilemapSetScrollX(i, (scroll[0+i*2] >> 7) - tiles_offsets_x);
+		GenericTilemapSetScrollY(i, (scroll[1+i*2] >> 7) - tiles_offsets_y);
+	}
+
+	memcpy (DrawVidRAM, DrvVidRAM, 0x10000);
+	memcpy (DrawSprBuf, DrvSprBuf, 0x1000);
+	memcpy (DrawSprSizeBuf, DrvSprSizeBuf, 0x80);
+	memcpy (DrawPalette, DrvPalette, 0x800 * sizeof(UINT32));
+
+	draw_sprite_flipscreen = sprite_flipscreen;
+}
+
 static void rallybik_draw_sprites()
 {
 	INT32 xoffs = 35;
 	INT32 xoffs_flipped = 15;
 
-	UINT16 *spriteram = (UINT16*)DrvSprBuf;
+	UINT16 *spriteram = (UINT16*)DrawSprBuf;
+
+	INT32 min_x, max_x, min_y, max_y;
+	GenericTilesGetClip(&min_x, &max_x, &min_y, &max_y);
 
 	for (INT32 offs = (0x1000/2)-4; offs >= 0; offs -= 4)
 	{
@@ -2377,7 +2419,7 @@ static void rallybik_draw_sprites()
 				sx -= xoffs;
 				sy -= 16;
 
-				if (sy < -15 || sx < -15 || sx >= nScreenWidth || sy >= nScreenHeight) continue;
+				if (sy < (min_y - 15) || sx < (min_x - 15) || sx >= max_x || sy >= max_y) continue;
 
 				UINT8 *gfx = DrvGfxROM1 + (code * 0x100);
 
@@ -2388,11 +2430,11 @@ static void rallybik_draw_sprites()
 
 				for (INT32 y = 0; y < 16; y++, dst += nScreenWidth, pri += nScreenWidth)
 				{
-					if ((sy + y) < 0 || (sy + y) >= nScreenHeight) continue;
+					if ((sy + y) < min_y || (sy + y) >= max_y) continue;
 
 					for (INT32 x = 0; x < 16; x++)
 					{
-						if ((sx + x) < 0 || (sx + x) >= nScreenWidth) continue;
+						if ((sx + x) < min_x || (sx + x) >= max_x) continue;
 
 						INT32 pxl = gfx[((y * 16) + x) ^ flip];
 
@@ -2409,20 +2451,8 @@ static void rallybik_draw_sprites()
 	}
 }
 
-static INT32 RallybikDraw()
+static void draw_layers()
 {
-	if (DrvRecalc) {
-		DrvPaletteUpdate();
-		DrvRecalc = 0;
-	}
-
-	for (INT32 i = 0; i < 4; i++) {
-		GenericTilemapSetScrollX(i, (scroll[0+i*2] >> 7) - tiles_offsets_x);
-		GenericTilemapSetScrollY(i, (scroll[1+i*2] >> 7) - tiles_offsets_y);
-	}
-
-	BurnTransferClear();
-
 	if (nBurnLayer & 8) GenericTilemapDraw(0, pTransDraw, TMAP_FORCEOPAQUE);
 
 	for (INT32 priority = 1; priority < 16; priority++)
@@ -2432,12 +2462,21 @@ static INT32 RallybikDraw()
 		if (nBurnLayer & 4) GenericTilemapDraw(1, pTransDraw, TMAP_SET_GROUP(priority)|priority);
 		if (nBurnLayer & 8) GenericTilemapDraw(0, pTransDraw, TMAP_SET_GROUP(priority)|priority);
 	}
+}
+
+// drawn in bands of the screen on the worker threads, see GenericTilesDrawBands()
+static void RallybikDrawBand()
+{
+	draw_layers();
 
 	rallybik_draw_sprites();
+}
 
-	BurnTransferCopy(DrvPalette);
+static void RallybikRender()
+{
+	BurnTransferClear();
 
-	return 0;
+	GenericTilesDrawBands(RallybikDrawBand);
 }
 
 static void toaplan1_draw_sprite_custom(UINT32 code, UINT32 color, INT32 flipx, INT32 flipy, INT32 sx, INT32 sy, INT32 priority)
@@ -2448,6 +2487,9 @@ static void toaplan1_draw_sprite_custom(UINT32 code, UINT32 color, INT32 flipx,
 	UINT8 *source_base = DrvGfxROM1 + (code * 0x40);
 	UINT8 *priority_bitmap = pPrioDraw;
 
+	INT32 min_x, max_x, min_y, max_y;
+	GenericTilesGetClip(&min_x, &max_x, &min_y, &max_y);
+
 	int sprite_screen_height = ((1<<16)*8+0x8000)>>16;
 	int sprite_screen_width = ((1<<16)*8+0x8000)>>16;
 
@@ -2482,29 +2524,29 @@ static void toaplan1_draw_sprite_custom(UINT32 code, UINT32 color, INT32 flipx,
 			y_index = 0;
 		}
 
-		if( sx < 0/*clip.min_x*/)
+		if( sx < min_x )
 		{
-			int pixels = 0-sx; //clip.min_x-sx;
+			int pixels = min_x-sx;
 			sx += pixels;
 			x_index_base += pixels*dx;
 		}
 
-		if( sy < 0/*clip.min_y*/)
+		if( sy < min_y )
 		{
-			int pixels = 0-sy; //clip.min_y-sy;
+			int pixels = min_y-sy;
 			sy += pixels;
 			y_index += pixels*dy;
 		}
 
-		if( ex > nScreenWidth/*clip.max_x+1*/)
+		if( ex > max_x )
 		{
-			int pixels = ex-nScreenWidth; //clip.max_x-1;
+			int pixels = ex-max_x;
 			ex -= pixels;
 		}
 
-		if( ey > nScreenHeight/*clip.max_y+1*/)
+		if( ey > max_y )
 		{
-			int pixels = ey-nScreenHeight; //clip.max_y-1;
+			int pixels = ey-max_y;
 			ey -= pixels;
 		}
 
@@ -2537,9 +2579,9 @@ static void toaplan1_draw_sprite_custom(UINT32 code, UINT32 color, INT32 flipx,
 
 static void draw_sprites()
 {
-	UINT16 *source = (UINT16*)DrvSprBuf;
-	UINT16 *size   = (UINT16*)DrvSprSizeBuf;
-	INT32 fcu_flipscreen = sprite_flipscreen;
+	UINT16 *source = (UINT16*)DrawSprBuf;
+	UINT16 *size   = (UINT16*)DrawSprSizeBuf;
+	INT32 fcu_flipscreen = draw_sprite_flipscreen;
 
 	for (INT32 offs = 0x1000/2 - 4; offs >= 0; offs -= 4)
 	{
@@ -2589,35 +2631,23 @@ static void draw_sprites()
 	}
 }
 
-static INT32 DrvDraw()
+static void DrvDrawBand()
 {
-	if (DrvRecalc) {
-		DrvPaletteUpdate();
-		DrvRecalc = 0;
-	}
+	draw_layers();
 
-	for (INT32 i = 0; i < 4; i++) {
-		GenericTilemapSetScrollX(i, (scroll[0+i*2] >> 7) - tiles_offsets_x);
-		GenericTilemapSetScrollY(i, (scroll[1+i*2] >> 7) - tiles_offsets_y);
-	}
+	draw_sprites();
+}
 
+static void DrvRender()
+{
 	BurnTransferClear();
 
-	if (nBurnLayer & 8) GenericTilemapDraw(0, pTransDraw, TMAP_FORCEOPAQUE);
-
-	for (INT32 priority = 1; priority < 16; priority++)
-	{
-		if (nBurnLayer & 1) GenericTilemapDraw(3, pTransDraw, TMAP_SET_GROUP(priority)|priority);
-		if (nBurnLayer & 2) GenericTilemapDraw(2, pTransDraw, TMAP_SET_GROUP(priority)|priority);
-		if (nBurnLayer & 4) GenericTilemapDraw(1, pTransDraw, TMAP_SET_GROUP(priority)|priority);
-		if (nBurnLayer & 8) GenericTilemapDraw(0, pTransDraw, TMAP_SET_GROUP(priority)|priority);
-	}
-
-	draw_sprites();
-
-	BurnTransferCopy(DrvPalette);
+	GenericTilesDrawBands(DrvDrawBand);
+}
 
-	return 0;
+static INT32 DrvDraw()
+{
+	return BurnVideoPipelineDraw();
 }
 
 static INT32 DrvFrame()
@@ -2663,7 +2693,7 @@ static INT32 DrvFrame()
 			if (interrupt_enable) SekSetIRQLine(4, CPU_IRQSTATUS_AUTO);
 
 			if (pBurnDraw) {
-				BurnDrvRedraw();
+				BurnVideoPipelineFrame();
 			}
 
 			memcpy (DrvSprBuf , DrvSprRAM , 0x1000);
@@ -2773,7 +2803,7 @@ struct BurnDriver BurnDrvRallybik = {
 	L"Rally Bike\0\u30C0\u30C3\u30B7\u30E5\uC91E\u90CE\0", NULL, NULL, NULL,
 	BDF_GAME_WORKING | BDF_ORIENTATION_VERTICAL | BDF_HISCORE_SUPPORTED, 2, HARDWARE_TOAPLAN_RAIZING, GBF_RACING, 0,
 	NULL, rallybikRomInfo, rallybikRomName, NULL, NULL, NULL, NULL, Drv2bInputInfo, RallybikDIPInfo,
-	RallybikInit, DrvExit, DrvFrame, RallybikDraw, DrvScan, &DrvRecalc, 0x800,
+	RallybikInit, DrvExit, DrvFrame, DrvDraw, DrvScan, &DrvRecalc, 0x800,
 	240, 320, 3, 4
 };
 
@@ -16,135 +16,84 @@ static INT32 nBurnYM2151SoundRate;
 static INT16* pBuffer;
 static INT16* pYM2151Buffer[2];
 
-static INT32 nBurnPosition;
-static UINT32 nSampleSize;
-static UINT32 nFractionalPosition;
-static UINT32 nSamplesRendered;
+static BurnResample* pYM2151Resample = NULL;
 
 static double YM2151Volumes[2];
 static INT32 YM2151RouteDirs[2];
 
 static INT32 YM2151BurnTimer = 0;
 
-static void YM2151RenderResample(INT16* pSoundBuf, INT32 nSegmentLength)
+// Apply the routes to the samples in pYM2151Buffer
+static void YM2151RenderRoutes(INT16* pSoundBuf, INT32 nSegmentLength)
 {
-#if defined FBNEO_DEBUG
-	if (!DebugSnd_YM2151Initted) bprintf(PRINT_ERROR, _T("YM2151RenderResample called without init\n"));
-#endif
-	
-	nBurnPosition += nSegmentLength;
-
-	if (nBurnPosition >= nBurnSoundRate) {
-		nBurnPosition = nSegmentLength;
-
-		pYM2151Buffer[0][1] = pYM2151Buffer[0][(nFractionalPosition >> 16) - 3];
-		pYM2151Buffer[0][2] = pYM2151Buffer[0][(nFractionalPosition >> 16) - 2];
-		pYM2151Buffer[0][3] = pYM2151Buffer[0][(nFractionalPosition >> 16) - 1];
-
-		pYM2151Buffer[1][1] = pYM2151Buffer[1][(nFractionalPosition >> 16) - 3];
-		pYM2151Buffer[1][2] = pYM2151Buffer[1][(nFractionalPosition >> 16) - 2];
-		pYM2151Buffer[1][3] = pYM2151Buffer[1][(nFractionalPosition >> 16) - 1];
-
-		nSamplesRendered -= (nFractionalPosition >> 16) - 4;
-
-		for (UINT32 i = 0; i <= nSamplesRendered; i++) {
-			pYM2151Buffer[0][4 + i] = pYM2151Buffer[0][(nFractionalPosition >> 16) + i];
-			pYM2151Buffer[1][4 + i] = pYM2151Buffer[1][(nFractionalPosition >> 16) + i];
+	INT32 nMixPos = BurnSoundMixPos(pSoundBuf);
+	if (nMixPos >= 0) {
+		for (INT32 nRoute = BURN_SND_YM2151_YM2151_ROUTE_1; nRoute <= BURN_SND_YM2151_YM2151_ROUTE_2; nRoute++) {
+			double nVolLeft = (YM2151RouteDirs[nRoute] & BURN_SND_ROUTE_LEFT) ? YM2151Volumes[nRoute] : 0.0;
+			double nVolRight = (YM2151RouteDirs[nRoute] & BURN_SND_ROUTE_RIGHT) ? YM2151Volumes[nRoute] : 0.0;
+			BurnSoundMixAdd(nMixPos, pYM2151Buffer[nRoute], pYM2151Buffer[nRoute], nSegmentLength, nVolLeft, nVolRight);
 		}
-
-		nFractionalPosition &= 0x0000FFFF;
-		nFractionalPosition |= 4 << 16;
+		return;
 	}
-
-	pYM2151Buffer[0] = pBuffer + 4 + nSamplesRendered;
-	pYM2151Buffer[1] = pBuffer + 4 + nSamplesRendered + 65536;
-
-	YM2151UpdateOne(0, pYM2151Buffer, (UINT32)(nBurnPosition + 1) * nBurnYM2151SoundRate / nBurnSoundRate - nSamplesRendered);
-	nSamplesRendered += (UINT32)(nBurnPosition + 1) * nBurnYM2151SoundRate / nBurnSoundRate - nSamplesRendered;
-
-	pYM2151Buffer[0] = pBuffer;
-	pYM2151Buffer[1] = pBuffer + 65536;
-
-	nSegmentLength <<= 1;
 	
-	for (INT32 i = 0; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
-		INT32 nLeftSample[4] = {0, 0, 0, 0};
-		INT32 nRightSample[4] = {0, 0, 0, 0};
-		INT32 nTotalLeftSample, nTotalRightSample;
+	for (INT32 n = 0; n < nSegmentLength; n++) {
+		INT32 nLeftSample = 0, nRightSample = 0;
 		
 		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample[0] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nLeftSample[1] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nLeftSample[2] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nLeftSample[3] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
+			nLeftSample += (INT32)(pYM2151Buffer[0][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
 		}
 		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample[0] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nRightSample[1] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nRightSample[2] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-			nRightSample[3] += (INT32)(pYM2151Buffer[0][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
+			nRightSample += (INT32)(pYM2151Buffer[0][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
 		}
 		
 		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample[0] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nLeftSample[1] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nLeftSample[2] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nLeftSample[3] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
+			nLeftSample += (INT32)(pYM2151Buffer[1][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
 		}
 		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample[0] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 3] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nRightSample[1] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 2] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nRightSample[2] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 1] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-			nRightSample[3] += (INT32)(pYM2151Buffer[1][(nFractionalPosition >> 16) - 0] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
+			nRightSample += (INT32)(pYM2151Buffer[1][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
 		}
 		
-		nTotalLeftSample = INTERPOLATE4PS_CUSTOM((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3], 16384.0);
-		nTotalRightSample = INTERPOLATE4PS_CUSTOM((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3], 16384.0);
-		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
+		nLeftSample = BURN_SND_CLIP(nLeftSample);
+		nRightSample = BURN_SND_CLIP(nRightSample);
 			
-		pSoundBuf[i + 0] = nTotalLeftSample;
-		pSoundBuf[i + 1] = nTotalRightSample;
+		pSoundBuf[(n << 1) + 0] = nLeftSample;
+		pSoundBuf[(n << 1) + 1] = nRightSample;
 	}
 }
 
+static void YM2151RenderResample(INT16* pSoundBuf, INT32 nSegmentLength)
+{
+	BURN_PROFILE_ZONE(PRF_ZONE_YM2151);
+
+#if defined FBNEO_DEBUG
+	if (!DebugSnd_YM2151Initted) bprintf(PRINT_ERROR, _T("YM2151RenderResample called without init\n"));
+#endif
+
+	INT32 nNeed = BurnResampleNeeded(pYM2151Resample, nSegmentLength);
+	YM2151UpdateOne(0, BurnResampleInput(pYM2151Resample, nNeed), nNeed);
+
+	pYM2151Buffer[0] = pBuffer;
+	pYM2151Buffer[1] = pBuffer + nSegmentLength;
+
+	BurnResampleRun(pYM2151Resample, nNeed, pYM2151Buffer, nSegmentLength);
+
+	YM2151RenderRoutes(pSoundBuf, nSegmentLength);
+}
+
 static void YM2151RenderNormal(INT16* pSoundBuf, INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YM2151);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM2151Initted) bprintf(PRINT_ERROR, _T("YM2151RenderNormal called without init\n"));
 #endif
 
-	nBurnPosition += nSegmentLength;
-
 	pYM2151Buffer[0] = pBuffer;
 	pYM2151Buffer[1] = pBuffer + nSegmentLength;
 
 	YM2151UpdateOne(0, pYM2151Buffer, nSegmentLength);
-	
-	for (INT32 n = 0; n < nSegmentLength; n++) {
-		INT32 nLeftSample = 0, nRightSample = 0;
-		
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(pYM2151Buffer[0][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-		}
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_1] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(pYM2151Buffer[0][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1]);
-		}
-		
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			nLeftSample += (INT32)(pYM2151Buffer[1][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-		}
-		if ((YM2151RouteDirs[BURN_SND_YM2151_YM2151_ROUTE_2] & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			nRightSample += (INT32)(pYM2151Buffer[1][n] * YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_2]);
-		}
-		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		pSoundBuf[(n << 1) + 0] = nLeftSample;
-		pSoundBuf[(n << 1) + 1] = nRightSample;
-	}
+
+	YM2151RenderRoutes(pSoundBuf, nSegmentLength);
 }
 
 void BurnYM2151Reset()
@@ -157,6 +106,9 @@ void BurnYM2151Reset()
 		BurnTimerReset();
 
 	YM2151ResetChip(0);
+
+	if (pYM2151Resample)
+		BurnResampleReset(pYM2151Resample);
 }
 
 void BurnYM2151Exit()
@@ -176,6 +128,8 @@ void BurnYM2151Exit()
 		BurnTimerExit();
 
 	BurnFree(pBuffer);
+	BurnResampleExit(pYM2151Resample);
+	pYM2151Resample = NULL;
 	
 	DebugSnd_YM2151Initted = 0;
 }
@@ -220,10 +174,9 @@ INT32 BurnYM2151Init(INT32 nClockFrequency, INT32 use_timer)
 	pBuffer = (INT16*)BurnMalloc(65536 * 2 * sizeof(INT16));
 	memset(pBuffer, 0, 65536 * 2 * sizeof(INT16));
 
-	nSampleSize = (UINT32)nBurnYM2151SoundRate * (1 << 16) / nBurnSoundRate;
-	nFractionalPosition = 4 << 16;
-	nSamplesRendered = 0;
-	nBurnPosition = 0;
+	if (nFMInterpolation == 3) {
+		pYM2151Resample = BurnResampleInit(nBurnYM2151SoundRate, nBurnSoundRate, 2);
+	}
 
 	// default routes
 	YM2151Volumes[BURN_SND_YM2151_YM2151_ROUTE_1] = 1.00;
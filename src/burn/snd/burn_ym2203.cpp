@@ -85,6 +85,8 @@ static void AY8910Render(INT32 nSegmentLength)
 
 static void YM2203Render(INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YM2203);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM2203Initted) bprintf(PRINT_ERROR, _T("YM2203Render called without init\n"));
 #endif
@@ -62,6 +62,8 @@ static void AY8910Render(INT32 nSegmentLength)
 
 static void YM2608Render(INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YM2608);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM2608Initted) bprintf(PRINT_ERROR, _T("YM2608Render called without init\n"));
 #endif
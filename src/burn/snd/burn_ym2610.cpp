@@ -67,6 +67,8 @@ static void AY8910Render(INT32 nSegmentLength)
 
 static void YM2610Render(INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YM2610);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM2610Initted) bprintf(PRINT_ERROR, _T("YM2610Render called without init\n"));
 #endif
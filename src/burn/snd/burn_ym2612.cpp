@@ -41,6 +41,8 @@ static INT32 YM2612StreamCallbackDummy(INT32)
 
 static void YM2612Render(INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YM2612);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM2612Initted) bprintf(PRINT_ERROR, _T("YM2612Render called without init\n"));
 #endif
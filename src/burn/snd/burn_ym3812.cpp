@@ -234,6 +234,8 @@ static INT32 YM3812StreamCallbackDummy(INT32)
 
 static void YM3812Render(INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YM3812);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YM3812Initted) bprintf(PRINT_ERROR, _T("YM3812Render called without init\n"));
 #endif
@@ -871,6 +871,8 @@ static void generate_samples(INT32 *left, INT32 *right, INT32 samples)
 
 void ES5506Update(INT16 *outputs, INT32 samples_len)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_ES5506);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_ES5506Initted) bprintf(PRINT_ERROR, _T("ES5506Update called without init\n"));
 #endif
@@ -686,6 +686,8 @@ void ics2115_update(INT32 segment_length)
 
 void ics2115_update(INT32 segment_length)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_ICS2115);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_ICS2115Initted) bprintf(PRINT_ERROR, _T("ics2115_update called without init\n"));
 #endif
@@ -380,6 +380,8 @@ static INT32 signdiff(INT32 a, INT32 b)
 
 void K054539Update(INT32 chip, INT16 *outputs, INT32 samples_len)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_K054539);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_K054539Initted) bprintf(PRINT_ERROR, _T("K054539Update called without init\n"));
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("K054539Update called with invalid chip %x\n"), chip);
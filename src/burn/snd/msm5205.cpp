@@ -196,6 +196,8 @@ static void MSM5205_vclk_callback(INT32 chip)
 
 void MSM5205Render(INT32 chip, INT16 *buffer, INT32 len)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_MSM5205);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_MSM5205Initted) bprintf(PRINT_ERROR, _T("MSM5205Render called without init\n"));
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("MSM5205Render called with invalid chip %x\n"), chip);
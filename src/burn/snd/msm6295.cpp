@@ -92,6 +92,9 @@ static INT32* pRightBuffer = NULL;
 
 static INT32 nPreviousSample[MAX_MSM6295], nCurrentSample[MAX_MSM6295];
 
+static INT32* pBlock = NULL;					// decoded samples for MSM6295Render_Linear()
+static INT32 nBlockSize = 0;
+
 static bool bAdd;
 
 void MSM6295Reset(INT32 nChip)
@@ -145,92 +148,126 @@ void MSM6295Scan(INT32 , INT32 *)
 	}
 }
 
-static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
+// Decode the next nCount samples of a voice and add them to pDest, stops early if the voice ends
+static void MSM6295DecodeVoice(INT32 nChip, INT32 nChannel, INT32* pDest, INT32 nCount)
 {
-	INT32 nVolume = MSM6295[nChip].nVolume;
-	INT32 nFractionalPosition = MSM6295[nChip].nFractionalPosition;
+	MSM6295ChannelInfo* pChannelInfo = &MSM6295[nChip].ChannelInfo[nChannel];
+
+	INT32 nPosition = pChannelInfo->nPosition;
+	INT32 nSampleCount = pChannelInfo->nSampleCount;
+	INT32 nSample = pChannelInfo->nSample;
+	INT32 nStep = pChannelInfo->nStep;
+	INT32 nDeltaByte = pChannelInfo->nDelta;
+	INT32 nVolume = pChannelInfo->nVolume;
+	INT32 nOutput = pChannelInfo->nOutput;
+
+	for (INT32 i = 0; i < nCount; i++) {
+		// Check for end of sample
+		if (nSampleCount-- == 0) {
+			nMSM6295Status[nChip] &= ~(1 << nChannel);
+			pChannelInfo->nPlaying = 0;
+			break;
+		}
 
-	INT32 nChannel, nDelta, nSample;
-	MSM6295ChannelInfo* pChannelInfo;
+		// Get new delta from ROM
+		INT32 nDelta;
+		if (nPosition & 1) {
+			nDelta = nDeltaByte & 0x0F;
+		} else {
+			nDeltaByte = MSM6295ReadData(nChip, (nPosition >> 1) & 0x3ffff);
+			nDelta = nDeltaByte >> 4;
+		}
 
-	while (nSegmentLength--) {
-		if (nFractionalPosition >= 0x1000) {
+		// Compute new sample
+		nSample += MSM6295DeltaTable[(nStep << 4) + nDelta];
+		if (nSample > 2047) {
+			nSample = 2047;
+		} else if (nSample < -2048) {
+			nSample = -2048;
+		}
+		nOutput = nSample * nVolume;
+
+		// Update step value
+		nStep += MSM6295StepShift[nDelta & 7];
+		if (nStep > 48) {
+			nStep = 48;
+		} else if (nStep < 0) {
+			nStep = 0;
+		}
 
-			nPreviousSample[nChip] = nCurrentSample[nChip];
+		pDest[i] += nOutput / 16;
 
-			do {
-				nCurrentSample[nChip] = 0;
+		nPosition++;
+	}
 
-				for (nChannel = 0; nChannel < 4; nChannel++) {
-					if (nMSM6295Status[nChip] & (1 << nChannel)) {
-						pChannelInfo = &MSM6295[nChip].ChannelInfo[nChannel];
+	pChannelInfo->nPosition = nPosition;
+	pChannelInfo->nSampleCount = nSampleCount;
+	pChannelInfo->nSample = nSample;
+	pChannelInfo->nStep = nStep;
+	pChannelInfo->nDelta = nDeltaByte;
+	pChannelInfo->nOutput = nOutput;
+}
 
-						// Check for end of sample
-						if (pChannelInfo->nSampleCount-- == 0) {
-							nMSM6295Status[nChip] &= ~(1 << nChannel);
-							MSM6295[nChip].ChannelInfo[nChannel].nPlaying = 0;
-							continue;
-						}
+// The chip samples a segment needs are decoded first, a voice at a time, into pBlock, and the
+// output samples are then interpolated from that.  pBlock[0] and pBlock[1] are the previous and
+// current samples carried over from the last segment.
+static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
+{
+	INT32 nVolume = MSM6295[nChip].nVolume;
+	UINT32 nPosition = MSM6295[nChip].nFractionalPosition;
+	UINT32 nSampleSize = MSM6295[nChip].nSampleSize;
 
-						// Get new delta from ROM
-						if (pChannelInfo->nPosition & 1) {
-							nDelta = pChannelInfo->nDelta & 0x0F;
-						} else {
-							pChannelInfo->nDelta = MSM6295ReadData(nChip, (pChannelInfo->nPosition >> 1) & 0x3ffff);
-							nDelta = pChannelInfo->nDelta >> 4;
-						}
+	if (nSegmentLength <= 0) {
+		return;
+	}
 
-						// Compute new sample
-						nSample = pChannelInfo->nSample + MSM6295DeltaTable[(pChannelInfo->nStep << 4) + nDelta];
-						if (nSample > 2047) {
-							nSample = 2047;
-						} else {
-							if (nSample < -2048) {
-								nSample = -2048;
-							}
-						}
-						pChannelInfo->nSample = nSample;
-						pChannelInfo->nOutput = (nSample * pChannelInfo->nVolume);
+	// Chip samples that start during this segment
+	INT32 nCount = (nPosition + (nSegmentLength - 1) * nSampleSize) >> 12;
 
-						// Update step value
-						pChannelInfo->nStep = pChannelInfo->nStep + MSM6295StepShift[nDelta & 7];
-						if (pChannelInfo->nStep > 48) {
-							pChannelInfo->nStep = 48;
-						} else {
-							if (pChannelInfo->nStep < 0) {
-								pChannelInfo->nStep = 0;
-							}
-						}
+	if (nCount + 2 > nBlockSize) {
+		BurnFree(pBlock);
+		nBlockSize = nCount + 2 + 256;
+		pBlock = (INT32*)BurnMalloc(nBlockSize * sizeof(INT32));
+	}
 
-						nCurrentSample[nChip] += pChannelInfo->nOutput / 16;
+	pBlock[0] = nPreviousSample[nChip];
+	pBlock[1] = nCurrentSample[nChip];
+	memset(pBlock + 2, 0, nCount * sizeof(INT32));
 
-						// Advance sample position
-						pChannelInfo->nPosition++;
-					}
-				}
+	for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
+		if (nMSM6295Status[nChip] & (1 << nChannel)) {
+			MSM6295DecodeVoice(nChip, nChannel, pBlock + 2, nCount);
+		}
+	}
 
-				nFractionalPosition -= 0x1000;
+	bool bLeft = (MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT;
+	bool bRight = (MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT;
+	INT32 nDone = 0, nPrevious = 0, nCurrent = 1;
 
-			} while (nFractionalPosition >= 0x1000);
+	for (INT32 i = 0; i < nSegmentLength; i++, nPosition += nSampleSize) {
+		INT32 nCrossed = nPosition >> 12;
+		if (nCrossed != nDone) {
+			nPrevious = nDone + 1;
+			nCurrent = nCrossed + 1;
+			nDone = nCrossed;
 		}
 
-		// Compute linearly interpolated sample
-		nSample = nPreviousSample[nChip] + (((nCurrentSample[nChip] - nPreviousSample[nChip]) * nFractionalPosition) >> 12);
-
-		// Scale all 4 channels
+		// Compute linearly interpolated sample, and scale all 4 channels
+		INT32 nSample = pBlock[nPrevious] + (((pBlock[nCurrent] - pBlock[nPrevious]) * (INT32)(nPosition & 0x0FFF)) >> 12);
 		nSample *= nVolume;
 
-		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-			*pLeftBuf++ += nSample;
+		if (bLeft) {
+			pLeftBuf[i] += nSample;
 		}
-		if ((MSM6295[nChip].nOutputDir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-			*pRightBuf++ += nSample;
+		if (bRight) {
+			pRightBuf[i] += nSample;
 		}
-
-		nFractionalPosition += MSM6295[nChip].nSampleSize;
 	}
 
-	MSM6295[nChip].nFractionalPosition = nFractionalPosition;
+	nPreviousSample[nChip] = pBlock[nPrevious];
+	nCurrentSample[nChip] = pBlock[nCurrent];
+
+	MSM6295[nChip].nFractionalPosition = nPosition - (nDone << 12);
 }
 
 static void MSM6295Render_Cubic(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf, INT32 nSegmentLength)
@@ -355,6 +392,8 @@ static void MSM6295Render_Cubic(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 
 INT32 MSM6295Render(INT32 nChip, INT16* pSoundBuf, INT32 nSegmentLength) // render per-chip
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_MSM6295);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_MSM6295Initted) bprintf(PRINT_ERROR, _T("MSM6295Render called without init\n"));
 	if (nChip > nLastMSM6295Chip) bprintf(PRINT_ERROR, _T("MSM6295Render called with invalid chip number %x\n"), nChip);
@@ -372,6 +411,17 @@ INT32 MSM6295Render(INT32 nChip, INT16* pSoundBuf, INT32 nSegmentLength) // rend
 	}
 
 	if (nChip == nLastMSM6295Chip)	{
+		INT32 nMixPos = BurnSoundMixPos(pSoundBuf);
+		if (nMixPos >= 0) {
+			// Shifted first, so negative samples round down as they do below
+			for (INT32 i = 0; i < nSegmentLength; i++) {
+				pLeftBuffer[i] >>= 8;
+				pRightBuffer[i] >>= 8;
+			}
+			BurnSoundMixAdd(nMixPos, pLeftBuffer, pRightBuffer, nSegmentLength, 1.0, 1.0);
+			return 0;
+		}
+
 		for (INT32 i = 0; i < nSegmentLength; i++) {
 			if (bAdd) {
 				pSoundBuf[0] = BURN_SND_CLIP(pSoundBuf[0] + (pLeftBuffer[i] >> 8));
@@ -490,6 +540,9 @@ void MSM6295Exit(INT32 nChip)
 	pLeftBuffer = NULL;
 	pRightBuffer = NULL;
 
+	BurnFree(pBlock);
+	nBlockSize = 0;
+
 	for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
 		BurnFree(MSM6295ChannelData[nChip][nChannel]);
 	}
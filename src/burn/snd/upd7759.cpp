@@ -75,6 +75,9 @@ static struct upd7759_chip *Chip = NULL;
 
 static INT32 nNumChips = 0;
 
+static INT16 *pBlock = NULL;				/* decoded samples for UPD7759Update() */
+static INT32 nBlockSize = 0;
+
 static const INT32 upd7759_step[16][16] =
 {
 	{ 0,  0,  1,  2,  3,   5,   7,  10,  0,   0,  -1,  -2,  -3,   -5,   -7,  -10 },
@@ -314,8 +317,75 @@ static void UPD7759SlaveModeUpdate()
 	}
 }
 
+// Run the chip for nLength output samples, storing the sample it outputs for each in pBlock
+static void UPD7759Decode(INT16 *pBlock, INT32 nLength)
+{
+	INT32 ClocksLeft = Chip->clocks_left;
+	INT16 Sample = Chip->sample;
+	UINT32 Step = Chip->step;
+	UINT32 Pos = Chip->pos;
+
+	/* in slave mode the state machine is clocked from UPD7759SlaveModeUpdate() instead */
+	if (Chip->rom == NULL) {
+		for (INT32 i = 0; i < nLength; i++) {
+			pBlock[i] = Sample;
+		}
+		Chip->pos = Pos + Step * nLength;
+		return;
+	}
+
+	for (INT32 i = 0; i < nLength; i++)
+	{
+		/* store the current sample */
+		pBlock[i] = Sample;
+
+		/* advance by the number of clocks/output sample */
+		Pos += Step;
+
+		/* most samples end in the same state they started in */
+		if ((INT32)(Pos >> FRAC_BITS) < ClocksLeft)
+		{
+			ClocksLeft -= Pos >> FRAC_BITS;
+			Pos &= FRAC_MASK;
+			continue;
+		}
+
+		/* handle clocks */
+		while (Pos >= FRAC_ONE)
+		{
+			INT32 ClocksThisTime = Pos >> FRAC_BITS;
+			if (ClocksThisTime > ClocksLeft)
+				ClocksThisTime = ClocksLeft;
+
+			/* clock once */
+			Pos -= ClocksThisTime * FRAC_ONE;
+			ClocksLeft -= ClocksThisTime;
+
+			/* if we're out of clocks, time to handle the next state */
+			if (ClocksLeft == 0)
+			{
+				/* advance one state; if we hit idle, bail */
+				UPD7759AdvanceState();
+				if (Chip->state == STATE_IDLE)
+					break;
+
+				/* reimport the variables that we cached */
+				ClocksLeft = Chip->clocks_left;
+				Sample = Chip->sample;
+			}
+		}
+	}
+
+	Chip->clocks_left = ClocksLeft;
+	Chip->pos = Pos;
+}
+
+// The chip's samples for the whole segment are decoded into pBlock first, then volume and
+// routing are applied to them in a separate loop
 void UPD7759Update(INT32 chip, INT16 *pSoundBuf, INT32 nLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_UPD7759);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_UPD7759Initted) bprintf(PRINT_ERROR, _T("UPD7759Update called without init\n"));
 	if (chip > nNumChips) bprintf(PRINT_ERROR, _T("UPD7759Update called with invalid chip %x\n"), chip);
@@ -323,67 +393,35 @@ void UPD7759Update(INT32 chip, INT16 *pSoundBuf, INT32 nLength)
 
 	Chip = Chips[chip];
 
-	INT32 ClocksLeft = Chip->clocks_left;
-	INT16 Sample = Chip->sample;
-	UINT32 Step = Chip->step;
-	UINT32 Pos = Chip->pos;
-	
-	/* loop until done */
-	if (Chip->state != STATE_IDLE)
-		while (nLength != 0)
-		{
-			/* store the current sample */
-			INT32 nLeftSample = 0;
-			INT32 nRightSample = 0;
-			
-			if ((Chip->output_dir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT) {
-				nLeftSample += (INT32)((Sample << 7) * Chip->volume);
-			}
-			if ((Chip->output_dir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT) {
-				nRightSample += (INT32)((Sample << 7) * Chip->volume);
-			}
-			
-			nLeftSample = BURN_SND_CLIP(nLeftSample);
-			nRightSample = BURN_SND_CLIP(nRightSample);
-			
-			pSoundBuf[0] = BURN_SND_CLIP(pSoundBuf[0] + nLeftSample);
-			pSoundBuf[1] = BURN_SND_CLIP(pSoundBuf[1] + nRightSample);
-			pSoundBuf += 2;
-			nLength--;
+	if (Chip->state != STATE_IDLE && nLength > 0)
+	{
+		if (nLength > nBlockSize) {
+			BurnFree(pBlock);
+			nBlockSize = nLength + 256;
+			pBlock = (INT16*)BurnMalloc(nBlockSize * sizeof(INT16));
+		}
 
-			/* advance by the number of clocks/output sample */
-			Pos += Step;
+		UPD7759Decode(pBlock, nLength);
 
-			/* handle clocks, but only in standalone mode */
-			while (Chip->rom && Pos >= FRAC_ONE)
-			{
-				INT32 ClocksThisTime = Pos >> FRAC_BITS;
-				if (ClocksThisTime > ClocksLeft)
-					ClocksThisTime = ClocksLeft;
-
-				/* clock once */
-				Pos -= ClocksThisTime * FRAC_ONE;
-				ClocksLeft -= ClocksThisTime;
-
-				/* if we're out of clocks, time to handle the next state */
-				if (ClocksLeft == 0)
-				{
-					/* advance one state; if we hit idle, bail */
-					UPD7759AdvanceState();
-					if (Chip->state == STATE_IDLE)
-						break;
-
-					/* reimport the variables that we cached */
-					ClocksLeft = Chip->clocks_left;
-					Sample = Chip->sample;
-				}
-			}
+		double Volume = Chip->volume;
+		bool bLeft = (Chip->output_dir & BURN_SND_ROUTE_LEFT) == BURN_SND_ROUTE_LEFT;
+		bool bRight = (Chip->output_dir & BURN_SND_ROUTE_RIGHT) == BURN_SND_ROUTE_RIGHT;
+
+		for (INT32 i = 0; i < nLength; i++)
+		{
+			INT32 nSample = BURN_SND_CLIP((INT32)((pBlock[i] << 7) * Volume));
+
+			pSoundBuf[0] = BURN_SND_CLIP(pSoundBuf[0] + (bLeft ? nSample : 0));
+			pSoundBuf[1] = BURN_SND_CLIP(pSoundBuf[1] + (bRight ? nSample : 0));
+			pSoundBuf += 2;
 		}
+	}
+
+	INT32 ClocksLeft = Chip->clocks_left;
 
 	if (SlaveMode && ClocksLeft > 0) UPD7759SlaveModeUpdate();
 
 	Chip->clocks_left = ClocksLeft;
-	Chip->pos = Pos;
 }
 
 void UPD7759Reset()
@@ -585,6 +623,9 @@ void UPD7759Exit()
 	BurnFree(Chips[0]);
 	BurnFree(Chips[1]);
 	SlaveMode = 0;
+
+	BurnFree(pBlock);
+	nBlockSize = 0;
 	
 	DebugSnd_UPD7759Initted = 0;
 	nNumChips = 0;
@@ -502,6 +502,8 @@ inline static void RenderADPCMLoop_Cubic()
 
 INT32 YMZ280BRender(INT16* pSoundBuf, INT32 nSegmentLength)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_YMZ280B);
+
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_YMZ280BInitted) bprintf(PRINT_ERROR, _T("YMZ280BRender called without init\n"));
 #endif
@@ -3,6 +3,18 @@
 #define MAX_TILEMAPS	32	// number of tile maps allowed
 #define MAX_GFXNUM
 
+// one tile as it was last drawn into the cache, see GenericTilemapUseCache()
+struct GenericTilemapCacheTile {
+	UINT8 *src;					// graphics it was drawn from, NULL if not drawn
+	UINT32 color;				// first palette entry ((color & color_mask) << depth) + color_offset
+	UINT32 flags;
+	INT32 gfxnum;
+	INT32 code;
+	INT32 category;
+	UINT8 mode;					// how it's copied to the screen, worked out each draw
+	UINT8 *trans;
+};
+
 struct GenericTilemap {
 	UINT8 initialized;
 	INT32 (*pScan)(INT32 col, INT32 row);
@@ -27,10 +39,17 @@ struct GenericTilemap {
 	UINT8 *dirty_tiles;			// 1 skip, 0 draw
 	INT32 dirty_tiles_enable;
 	UINT8 *skip_tiles[MAX_GFX];
+	UINT16 *cache_pixel;		// the whole map drawn out, NULL unless GenericTilemapUseCache() is used
+	UINT8 *cache_pen;			// the same without the palette added, for transparency
+	GenericTilemapCacheTile *cache_tiles;	// by map position (row * mwidth + col)
+	INT32 *cache_offset;		// pScan() of each map position
+	UINT8 *cache_dirty;			// by offset, 1 forces the tile to be drawn again
+	UINT8 *cache_cols;			// map columns and rows on screen, used while drawing
+	UINT8 *cache_rows;
 };
 
 static GenericTilemap maps[MAX_TILEMAPS];
-static GenericTilemap *cur_map;
+static BURN_THREAD_LOCAL GenericTilemap *cur_map;
 GenericTilesGfx GenericGfxData[MAX_TILEMAPS];
 
 void GenericTilemapInit(INT32 which, INT32 (*pScan)(INT32 col, INT32 row), void (*pTile)(INT32 offs, INT32 *tile_gfx, INT32 *tile_code, INT32 *tile_color, UINT32 *tile_flags, INT32 *category), UINT32 tile_width, UINT32 tile_height, UINT32 map_width, UINT32 map_height)
@@ -158,6 +177,13 @@ void GenericTilemapExit()
 		if (cur_map->scrollx_table) BurnFree(cur_map->scrollx_table);
 		if (cur_map->transparent[0]) BurnFree(cur_map->transparent[0]);
 		if (cur_map->dirty_tiles) BurnFree(cur_map->dirty_tiles);
+		if (cur_map->cache_pixel) BurnFree(cur_map->cache_pixel);
+		if (cur_map->cache_pen) BurnFree(cur_map->cache_pen);
+		if (cur_map->cache_tiles) BurnFree(cur_map->cache_tiles);
+		if (cur_map->cache_offset) BurnFree(cur_map->cache_offset);
+		if (cur_map->cache_dirty) BurnFree(cur_map->cache_dirty);
+		if (cur_map->cache_cols) BurnFree(cur_map->cache_cols);
+		if (cur_map->cache_rows) BurnFree(cur_map->cache_rows);
 
 		for (INT32 j = 0; j < MAX_GFX; j++) {
 			if (cur_map->skip_tiles[j]) {
@@ -738,13 +764,19 @@ void GenericTilemapSetTileDirty(INT32 which, UINT32 offset)
 		return;
 	}
 
-	if (cur_map->dirty_tiles_enable == 0) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapSetTileDirty(%d, %x) called without calling GenericTilemapUseDirtyTiles first!\n"), which, offset);
+	if (cur_map->dirty_tiles_enable == 0 && cur_map->cache_pixel == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapSetTileDirty(%d, %x) called without calling GenericTilemapUseDirtyTiles or GenericTilemapUseCache first!\n"), which, offset);
 		return;
 	}
 #endif
 
-	cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)] = 1;
+	if (cur_map->dirty_tiles_enable) {
+		cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)] = 1;
+	}
+
+	if (cur_map->cache_pixel) {
+		cur_map->cache_dirty[offset % (cur_map->mwidth * cur_map->mheight)] = 1;
+	}
 }
 
 void GenericTilemapAllTilesDirty(INT32 which)
@@ -764,13 +796,19 @@ void GenericTilemapAllTilesDirty(INT32 which)
 		return;
 	}
 
-	if (cur_map->dirty_tiles_enable == 0) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapAllTilesDirty(%d) called without calling GenericTilemapUseDirtyTiles first!\n"), which);
+	if (cur_map->dirty_tiles_enable == 0 && cur_map->cache_pixel == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapAllTilesDirty(%d) called without calling GenericTilemapUseDirtyTiles or GenericTilemapUseCache first!\n"), which);
 		return;
 	}
 #endif
 
-	memset (cur_map->dirty_tiles, 1, cur_map->mwidth * cur_map->mheight);
+	if (cur_map->dirty_tiles_enable) {
+		memset (cur_map->dirty_tiles, 1, cur_map->mwidth * cur_map->mheight);
+	}
+
+	if (cur_map->cache_pixel) {
+		memset (cur_map->cache_dirty, 1, cur_map->mwidth * cur_map->mheight);
+	}
 }
 
 INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
@@ -799,6 +837,470 @@ INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
 	return cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)];
 }
 
+void GenericTilemapUseCache(INT32 which)
+{
+#if defined FBNEO_DEBUG
+	if (which < 0 || which >= MAX_TILEMAPS) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseCache(%d) called with impossible tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	cur_map = &maps[which];
+
+#if defined FBNEO_DEBUG
+	if (cur_map->initialized == 0) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseCache(%d) called without initialized tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	if (cur_map->cache_pixel) {
+		return;
+	}
+
+	INT32 tiles = cur_map->mwidth * cur_map->mheight;
+	INT32 pixels = tiles * cur_map->twidth * cur_map->theight;
+
+	cur_map->cache_pixel = (UINT16*)BurnMalloc(pixels * sizeof(UINT16));
+	cur_map->cache_pen = (UINT8*)BurnMalloc(pixels);
+	cur_map->cache_tiles = (GenericTilemapCacheTile*)BurnMalloc(tiles * sizeof(GenericTilemapCacheTile));
+	cur_map->cache_offset = (INT32*)BurnMalloc(tiles * sizeof(INT32));
+	cur_map->cache_dirty = (UINT8*)BurnMalloc(tiles);
+	cur_map->cache_cols = (UINT8*)BurnMalloc(cur_map->mwidth);
+	cur_map->cache_rows = (UINT8*)BurnMalloc(cur_map->mheight);
+
+	memset (cur_map->cache_tiles, 0, tiles * sizeof(GenericTilemapCacheTile)); // nothing drawn yet
+	memset (cur_map->cache_dirty, 0, tiles);
+
+	for (UINT32 row = 0; row < cur_map->mheight; row++) {
+		for (UINT32 col = 0; col < cur_map->mwidth; col++) {
+			cur_map->cache_offset[row * cur_map->mwidth + col] = cur_map->pScan(col, row);
+		}
+	}
+}
+
+/*================================================================================================
+Cached drawing
+
+With GenericTilemapUseCache() the whole map is kept drawn out in cache_pixel, along with the pens
+in cache_pen so transparency can still be worked out when it's copied to the screen.  Every draw
+asks pTile about the tiles that are on screen, as usual, but a tile is only drawn into the cache
+again when what it draws (graphics, code, color or flipping) has changed or it was marked dirty.
+If the tilemap uses dirty tiles as well, pTile is only asked about tiles marked dirty, which
+saves the most but leaves it to the driver to mark them (all of them when a color bank changes).
+What's on screen is then copied out of the cache a row at a time.  How each tile is copied
+(skipped, opaque or which pens are transparent) is worked out once per draw.
+================================================================================================*/
+
+#define TCACHE_SKIP			0
+#define TCACHE_OPAQUE		1
+#define TCACHE_TRANSCOLOR	2		// pens of transcolor aren't copied
+#define TCACHE_TRANSTAB		3		// pens with a non-zero entry in trans aren't copied
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define TCACHE_SSE2
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define TCACHE_NEON
+ #include <arm_neon.h>
+#endif
+
+struct GenericTilemapCacheDraw {
+	UINT16 *dest;
+	UINT8 *prio;
+	INT32 priority;
+	INT32 category_or;
+	INT32 opaque;
+	INT32 opaque2;
+	INT32 tgroup;
+	INT32 linescroll;			// transparency is always used, as GenericTilemapDraw() does for line scroll
+};
+
+static void GenericTilemapCacheTileDraw(GenericTilemapCacheTile *tile, INT32 pos)
+{
+	INT32 code, color, gfxnum, category = 0, offset = cur_map->cache_offset[pos];
+	UINT32 flags;
+
+	cur_map->pTile(offset, &gfxnum, &code, &color, &flags, &category);
+
+	GenericTilesGfx *gfx = &GenericGfxData[gfxnum];
+
+#if defined FBNEO_DEBUG
+	if (gfx->gfxbase == NULL || ((UINT32)gfx->width != cur_map->twidth) || ((UINT32)gfx->height != cur_map->theight)) {
+		bprintf (PRINT_ERROR,_T("GenericTilemapDraw() gfx[%d] not initialized or tile dimensions (%dx%d) do not match tilemap tile dimensions (%dx%d)!\n"), gfxnum, gfx->width, gfx->height, cur_map->twidth, cur_map->theight);
+		tile->src = NULL;
+		return;
+	}
+#endif
+
+	code %= gfx->code_mask;
+
+	UINT8 *src = gfx->gfxbase + (code * cur_map->twidth * cur_map->theight);
+	UINT32 palette = ((color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+
+	offset %= cur_map->mwidth * cur_map->mheight;
+
+	if (tile->src != src || tile->color != palette || ((tile->flags ^ flags) & (TILE_FLIPX | TILE_FLIPY)) || cur_map->cache_dirty[offset])
+	{
+		INT32 mapwidth = cur_map->mwidth * cur_map->twidth;
+		INT32 start = ((pos / cur_map->mwidth) * cur_map->theight * mapwidth) + ((pos % cur_map->mwidth) * cur_map->twidth);
+		INT32 flipx = (flags & TILE_FLIPX) ? (cur_map->twidth - 1) : 0;
+		INT32 flipy = (flags & TILE_FLIPY) ? (cur_map->theight - 1) : 0;
+
+		for (UINT32 y = 0; y < cur_map->theight; y++)
+		{
+			UINT8 *g = src + (y ^ flipy) * cur_map->twidth;
+			UINT16 *pixel = cur_map->cache_pixel + start + (y * mapwidth);
+			UINT8 *pen = cur_map->cache_pen + start + (y * mapwidth);
+
+			for (UINT32 x = 0; x < cur_map->twidth; x++)
+			{
+				pen[x] = g[flipx ? (flipx - x) : x];
+				pixel[x] = pen[x] + palette;
+			}
+		}
+
+		cur_map->cache_dirty[offset] = 0;
+	}
+
+	tile->src = src;
+	tile->color = palette;
+	tile->flags = flags;
+	tile->gfxnum = gfxnum;
+	tile->code = code;
+	tile->category = category;
+}
+
+// mark the map columns or rows of map pixels start to start + len (wrapping around)
+static void GenericTilemapCacheMark(UINT8 *used, INT32 start, INT32 len, INT32 size, INT32 count)
+{
+	if (len >= size * count) {
+		memset (used, 1, count);
+		return;
+	}
+
+	INT32 first = start / size;
+	INT32 last = (start + len - 1) / size;
+
+	for (INT32 i = first; i <= last; i++) {
+		used[i % count] = 1;
+	}
+}
+
+// bring the tiles in the marked rows and columns up to date, and work out how to copy them
+static void GenericTilemapCacheUpdate(GenericTilemapCacheDraw *draw)
+{
+	for (UINT32 row = 0; row < cur_map->mheight; row++)
+	{
+		if (cur_map->cache_rows[row] == 0) continue;
+
+		for (UINT32 col = 0; col < cur_map->mwidth; col++)
+		{
+			if (cur_map->cache_cols[col] == 0) continue;
+
+			INT32 pos = row * cur_map->mwidth + col;
+			GenericTilemapCacheTile *tile = &cur_map->cache_tiles[pos];
+
+			// with dirty tiles as well, only tiles marked dirty are looked at again
+			if (cur_map->dirty_tiles_enable == 0 || tile->src == NULL || cur_map->cache_dirty[cur_map->cache_offset[pos] % (cur_map->mwidth * cur_map->mheight)]) {
+				GenericTilemapCacheTileDraw(tile, pos);
+			}
+
+			tile->mode = TCACHE_SKIP;
+			tile->trans = NULL;
+
+			if (tile->src == NULL) continue;
+
+			if (draw->opaque == 0)
+			{
+				if (cur_map->skip_tiles[tile->gfxnum] && (cur_map->flags & TMAP_TRANSPARENT)) {
+					if (cur_map->skip_tiles[tile->gfxnum][tile->code]) continue;
+				}
+
+				if (tile->flags & TILE_SKIP) continue;
+
+				if ((tile->flags & TILE_GROUP_ENABLE) && (INT32)((tile->flags >> 16) & 0xff) != draw->tgroup) continue;
+			}
+
+			INT32 category = tile->category | draw->category_or;
+			if (category && (cur_map->flags & TMAP_TRANSMASK) && cur_map->transparent[category] == NULL) {
+				category = 0;
+			}
+
+			if (draw->linescroll) {
+				tile->mode = TCACHE_TRANSTAB;
+				tile->trans = cur_map->transparent[category];
+			} else if ((tile->flags & TILE_OPAQUE) || draw->opaque || draw->opaque2) {
+				tile->mode = TCACHE_OPAQUE;
+			} else if (cur_map->flags & TMAP_TRANSPARENT) {
+				tile->mode = TCACHE_TRANSCOLOR;
+			} else if (cur_map->flags & TMAP_TRANSMASK) {
+				tile->mode = TCACHE_TRANSTAB;
+				tile->trans = cur_map->transparent[category];
+			} else {
+				tile->mode = TCACHE_OPAQUE;
+			}
+		}
+	}
+}
+
+// copy len pixels, leaving out pens of transcolor (-1 to copy them all), 8 at a time where we can
+static inline void GenericTilemapCacheCopy(UINT16 *d, UINT8 *pri, UINT16 *s, UINT8 *p, INT32 len, INT32 transcolor, UINT8 priority, UINT8 primask)
+{
+	INT32 x = 0;
+
+#if defined (TCACHE_SSE2)
+	const __m128i vZero = _mm_setzero_si128();
+	const __m128i vTrans = _mm_set1_epi16(transcolor);
+	const __m128i vPriMask = _mm_set1_epi8(primask);
+	const __m128i vPriority = _mm_set1_epi8(priority);
+
+	if (transcolor < 0) {
+		memcpy (d, s, len * sizeof(UINT16));
+
+		for (; x + 16 <= len; x += 16) {
+			__m128i q = _mm_loadu_si128((__m128i*)(pri + x));
+			_mm_storeu_si128((__m128i*)(pri + x), _mm_or_si128(_mm_and_si128(q, vPriMask), vPriority));
+		}
+	}
+
+	for (; x + 8 <= len; x += 8) {
+		__m128i m = _mm_cmpeq_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)(p + x)), vZero), vTrans);
+		__m128i c = _mm_loadu_si128((__m128i*)(s + x));
+		__m128i o = _mm_loadu_si128((__m128i*)(d + x));
+		_mm_storeu_si128((__m128i*)(d + x), _mm_or_si128(_mm_and_si128(m, o), _mm_andnot_si128(m, c)));
+
+		__m128i m8 = _mm_packs_epi16(m, m);
+		__m128i q = _mm_loadl_epi64((__m128i*)(pri + x));
+		__m128i n = _mm_or_si128(_mm_and_si128(q, vPriMask), vPriority);
+		_mm_storel_epi64((__m128i*)(pri + x), _mm_or_si128(_mm_and_si128(m8, q), _mm_andnot_si128(m8, n)));
+	}
+#elif defined (TCACHE_NEON)
+	const uint16x8_t vTrans = vdupq_n_u16((UINT16)transcolor);
+	const uint8x8_t vPriMask = vdup_n_u8(primask);
+	const uint8x8_t vPriority = vdup_n_u8(priority);
+
+	for (; x + 8 <= len; x += 8) {
+		uint16x8_t m = vceqq_u16(vmovl_u8(vld1_u8(p + x)), vTrans);
+		vst1q_u16(d + x, vbslq_u16(m, vld1q_u16(d + x), vld1q_u16(s + x)));
+
+		uint8x8_t q = vld1_u8(pri + x);
+		vst1_u8(pri + x, vbsl_u8(vmovn_u16(m), q, vorr_u8(vand_u8(q, vPriMask), vPriority)));
+	}
+#endif
+
+	for (; x < len; x++) {
+		if (p[x] != transcolor) {
+			d[x] = s[x];
+			pri[x] = priority | (pri[x] & primask);
+		}
+	}
+}
+
+// copy screen pixels sx to ex of row sy from map row my, starting at map pixel mx, going
+// backwards through the map when it's flipped on screen (nDir is -1)
+template <INT32 nDir>
+static void GenericTilemapCacheCopyRow(GenericTilemapCacheDraw *draw, INT32 sy, INT32 sx, INT32 ex, INT32 my, INT32 mx)
+{
+	INT32 twidth = cur_map->twidth;
+	INT32 mapwidth = cur_map->mwidth * twidth;
+	GenericTilemapCacheTile *tiles = cur_map->cache_tiles + (my / cur_map->theight) * cur_map->mwidth;
+
+	UINT16 *dest = draw->dest + sy * nScreenWidth;
+	UINT8 *prio = draw->prio + sy * nScreenWidth;
+	UINT16 *pixel = cur_map->cache_pixel + my * mapwidth;
+	UINT8 *pen = cur_map->cache_pen + my * mapwidth;
+
+	UINT8 priority = draw->priority;
+	UINT8 primask = GenericTilesPRIMASK;
+	INT32 transcolor = cur_map->transcolor;
+
+	while (sx < ex)
+	{
+		INT32 col = mx / twidth;
+		GenericTilemapCacheTile *tile = &tiles[col];
+
+		// pixels left in this tile
+		INT32 len = (nDir > 0) ? (((col + 1) * twidth) - mx) : ((mx - (col * twidth)) + 1);
+		if (len > ex - sx) len = ex - sx;
+
+		// tiles next to each other that are copied the same way are copied in one go
+		for (INT32 next = col + nDir; sx + len < ex && next >= 0 && next < (INT32)cur_map->mwidth && tiles[next].mode == tile->mode && tiles[next].trans == tile->trans; next += nDir) {
+			len += twidth;
+			if (len > ex - sx) len = ex - sx;
+		}
+
+		UINT16 *d = dest + sx;
+		UINT8 *pri = prio + sx;
+		UINT16 *s = pixel + mx;
+		UINT8 *p = pen + mx;
+
+		if (nDir > 0 && (tile->mode == TCACHE_OPAQUE || tile->mode == TCACHE_TRANSCOLOR))
+		{
+			GenericTilemapCacheCopy(d, pri, s, p, len, (tile->mode == TCACHE_OPAQUE) ? -1 : transcolor, priority, primask);
+		}
+		else if (tile->mode != TCACHE_SKIP)
+		{
+			// flipped or using a transparency table, a pixel at a time (without branching on
+			// the pens, they're too unpredictable)
+			UINT8 *trans = tile->trans;
+
+			for (INT32 x = 0; x < len; x++) {
+				INT32 pxl = p[x * nDir];
+				INT32 draw_pixel;
+
+				if (tile->mode == TCACHE_OPAQUE) {
+					draw_pixel = 1;
+				} else if (tile->mode == TCACHE_TRANSCOLOR) {
+					draw_pixel = (pxl != transcolor);
+				} else {
+					draw_pixel = (trans[pxl] == 0);
+				}
+
+				UINT16 mask = -draw_pixel;
+				d[x] = (s[x * nDir] & mask) | (d[x] & ~mask);
+				pri[x] = (pri[x] & (primask | ~mask)) | (priority & mask);
+			}
+		}
+
+		sx += len;
+		mx += nDir * len;
+		if (mx >= mapwidth) mx -= mapwidth;
+		if (mx < 0) mx += mapwidth;
+	}
+}
+
+// work out which screen pixels from min to max the "Fast!" path in GenericTilemapDraw() covers
+// for one axis, and which map pixel the first of them shows.  Returns the direction to step
+// through the map in, -1 when the tilemap is flipped on screen.
+static INT32 GenericTilemapCacheAxis(INT32 min, INT32 max, INT32 scroll, UINT32 size, UINT32 count, INT32 flip, INT32 *start, INT32 *end, INT32 *map)
+{
+	INT32 shift = (UINT32)scroll % size;	// unsigned, as in GenericTilemapDraw()
+	INT32 first = min - (min % (INT32)size);
+	INT32 last = first + (((max + (INT32)size - 1) - first) / (INT32)size) * size;
+	INT32 m;
+
+	if (flip) {
+		*start = ((max - min) - size) - last + shift;
+		*end = ((max - min) - size) - first + shift + size;
+	} else {
+		*start = first - shift;
+		*end = last + size - shift;
+	}
+
+	if (*start < min) *start = min;
+	if (*end > max) *end = max;
+
+	if (flip) {
+		m = scroll + ((max - min) - 1) - *start;
+	} else {
+		m = scroll + *start;
+	}
+
+	*map = (UINT32)m % (size * count);
+
+	return flip ? -1 : 1;
+}
+
+// draw from the cache, returns 1 if the tilemap's scrolling isn't handled here
+static INT32 GenericTilemapCacheDrawMap(UINT16 *Bitmap, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, INT32 priority, INT32 category_or, INT32 opaque, INT32 opaque2, INT32 tgroup)
+{
+	GenericTilemapCacheDraw draw = { Bitmap, pPrioDraw, priority, category_or, opaque, opaque2, tgroup, 0 };
+
+	INT32 mapwidth = cur_map->mwidth * cur_map->twidth;
+	INT32 mapheight = cur_map->mheight * cur_map->theight;
+
+	// column scroll of less than a tile is drawn a pixel at a time
+	if (cur_map->scrolly_table != NULL && cur_map->scroll_cols > cur_map->mwidth) {
+		return 1;
+	}
+
+	memset (cur_map->cache_cols, 0, cur_map->mwidth);
+	memset (cur_map->cache_rows, 0, cur_map->mheight);
+
+	if (cur_map->scrollx_table != NULL && cur_map->scroll_rows > cur_map->mheight)
+	{
+		// line scroll, as drawn by GenericTilemapDraw() when the tilemap isn't flipped
+		if (cur_map->flags & (TMAP_FLIPX | TMAP_FLIPY)) {
+			return 1;
+		}
+
+		for (INT32 y = miny; y < maxy; y++) {
+			INT32 my = (UINT32)(cur_map->scrolly + y + cur_map->yoffset) % (UINT32)mapheight;
+			cur_map->cache_rows[my / cur_map->theight] = 1;
+		}
+
+		memset (cur_map->cache_cols, 1, cur_map->mwidth);
+
+		draw.linescroll = 1;
+
+		GenericTilemapCacheUpdate(&draw);
+
+		INT32 bitmap_width = maxx - minx;
+		INT32 last = ((bitmap_width + cur_map->twidth - 1) / cur_map->twidth) * cur_map->twidth;
+
+		for (INT32 y = miny; y < maxy; y++)
+		{
+			// unsigned, as in GenericTilemapDraw()
+			INT32 scrolly = (UINT32)(cur_map->scrolly + y + cur_map->yoffset) % (UINT32)mapheight;
+			INT32 scrollx = (UINT32)(cur_map->scrollx_table[(scrolly * cur_map->scroll_rows) / mapheight] - cur_map->xoffset) % (UINT32)mapwidth;
+			INT32 scrx = scrollx % cur_map->twidth;
+
+			INT32 sx = (minx > -scrx) ? minx : -scrx;
+			INT32 ex = (maxx < (INT32)(last + cur_map->twidth) - scrx) ? maxx : ((INT32)(last + cur_map->twidth) - scrx);
+
+			INT32 mx = (UINT32)(sx + scrollx) % (UINT32)mapwidth;
+
+			GenericTilemapCacheCopyRow<1>(&draw, y, sx, ex, scrolly, mx);
+		}
+
+		return 0;
+	}
+
+	if (cur_map->scroll_rows <= 1 && cur_map->scroll_cols <= 1)
+	{
+		// scrollx and scrolly
+		INT32 sx, ex, mx, sy, ey, my;
+
+		INT32 dirx = GenericTilemapCacheAxis(minx, maxx, cur_map->scrollx - cur_map->xoffset, cur_map->twidth, cur_map->mwidth, cur_map->flags & TMAP_FLIPX, &sx, &ex, &mx);
+		INT32 diry = GenericTilemapCacheAxis(miny, maxy, cur_map->scrolly - cur_map->yoffset, cur_map->theight, cur_map->mheight, cur_map->flags & TMAP_FLIPY, &sy, &ey, &my);
+
+		if (sx >= ex || sy >= ey) {
+			return 0;
+		}
+
+		GenericTilemapCacheMark(cur_map->cache_cols, (dirx > 0) ? mx : (mx - (ex - sx - 1) + mapwidth), ex - sx, cur_map->twidth, cur_map->mwidth);
+		GenericTilemapCacheMark(cur_map->cache_rows, (diry > 0) ? my : (my - (ey - sy - 1) + mapheight), ey - sy, cur_map->theight, cur_map->mheight);
+
+		GenericTilemapCacheUpdate(&draw);
+
+		for (INT32 y = sy; y < ey; y++)
+		{
+			if (dirx > 0) {
+				GenericTilemapCacheCopyRow<1>(&draw, y, sx, ex, my, mx);
+			} else {
+				GenericTilemapCacheCopyRow<-1>(&draw, y, sx, ex, my, mx);
+			}
+
+			my += diry;
+			if (my >= mapheight) my -= mapheight;
+			if (my < 0) my += mapheight;
+		}
+
+		return 0;
+	}
+
+	return 1;
+}
+
+#undef TCACHE_SKIP
+#undef TCACHE_OPAQUE
+#undef TCACHE_TRANSCOLOR
+#undef TCACHE_TRANSTAB
+#undef TCACHE_SSE2
+#undef TCACHE_NEON
+
 void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 priority_mask)
 {
 #if defined FBNEO_DEBUG
@@ -835,6 +1337,16 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 		if (maxy >= nScreenHeight) maxy = nScreenHeight;
 	}
 
+	// when drawing a band of GenericTilesDrawBands(), the map is still flipped over the whole clip
+	INT32 band_minx, band_maxx, band_miny, band_maxy;
+	INT32 band = GenericTilesGetUnbandedClip(&band_minx, &band_maxx, &band_miny, &band_maxy);
+	if (band_miny < 0) band_miny = 0;
+	if (band_maxy > nScreenHeight) band_maxy = nScreenHeight;
+	INT32 flip_height = band ? (band_maxy - band_miny) : (maxy - miny);
+
+	// the bands share dirty_tiles and clear what they draw, so they draw every tile instead
+	INT32 skip_clean = cur_map->dirty_tiles_enable && cur_map->cache_pixel == NULL && band == 0;
+
 	GenericTilesPRIMASK = priority_mask;
 
 	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
@@ -843,6 +1355,12 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 	INT32 tgroup = (priority >> 8) & 0xff;
 	priority &= 0xff;
 
+	if (cur_map->cache_pixel && band == 0) {
+		if (GenericTilemapCacheDrawMap(Bitmap, minx, maxx, miny, maxy, priority, category_or, opaque, opaque2, tgroup) == 0) {
+			return;
+		}
+	}
+
 	// column (less than tile size) and line scroll
 	if ((cur_map->scrolly_table != NULL) && (cur_map->scroll_cols > cur_map->mwidth))
 	{
@@ -878,7 +1396,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 				INT32 code, color, group, gfxnum, category = 0, offset = cur_map->pScan(col,row);
 				UINT32 flags;
 
-				if (cur_map->dirty_tiles_enable) {
+				if (skip_clean) {
 					if (cur_map->dirty_tiles[offset] == 0) continue;
 					cur_map->dirty_tiles[offset] = 0;
 				}
@@ -960,7 +1478,11 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 		UINT16 *dest = Bitmap;
 		UINT8 *prio = pPrioDraw;
 
-		for (INT32 y = miny; y < maxy; y++, prio += bitmap_width) // line by line
+		// flipped, the lines of this band can come from anywhere in the clip
+		INT32 starty = (band && (cur_map->flags & TMAP_FLIPY)) ? band_miny : miny;
+		INT32 endy = (band && (cur_map->flags & TMAP_FLIPY)) ? band_maxy : maxy;
+
+		for (INT32 y = starty; y < endy; y++, prio += bitmap_width) // line by line
 		{
 			INT32 scrolly = (cur_map->scrolly + y + cur_map->yoffset) % (cur_map->mheight * cur_map->theight);
 
@@ -975,7 +1497,9 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 
 			INT32 sy = y;
 			if (cur_map->flags & TMAP_FLIPY) {
-				sy = ((maxy - miny) - cur_map->theight) - sy;
+				sy = (flip_height - cur_map->theight) - sy;
+
+				if (band && (sy < miny || sy >= maxy)) continue;
 			}
 
 			dest = Bitmap + sy * nScreenWidth;
@@ -989,7 +1513,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 				INT32 code, color, group, gfxnum, category = 0, offset = cur_map->pScan(col,row);
 				UINT32 flags;
 
-				if (cur_map->dirty_tiles_enable) {
+				if (skip_clean) {
 					if (cur_map->dirty_tiles[offset] == 0) continue;
 					cur_map->dirty_tiles[offset] = 0;
 				}
@@ -1126,8 +1650,18 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 			starty = tmp;
 		}
 #endif
+		if (band && (cur_map->flags & TMAP_FLIPY)) {
+			starty = band_miny - (band_miny % cur_map->theight);
+			endy = band_maxy + cur_map->theight;
+		}
+
 		for (INT32 y = starty; y < endy; y += cur_map->theight)
 		{
+			if (band && (cur_map->flags & TMAP_FLIPY)) {
+				INT32 sy = (flip_height - cur_map->theight) - (y - syshift);
+				if ((sy >= maxy) || (sy < (INT32)(miny - (cur_map->theight - 1)))) continue;
+			}
+
 			INT32 syy = (y + scrolly) % (cur_map->theight * cur_map->mheight);
 
 			for (INT32 x = startx; x < endx; x += cur_map->twidth)
@@ -1138,7 +1672,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 				INT32 offset = cur_map->pScan(sxx/cur_map->twidth,syy/cur_map->theight);
 				UINT32 flags;
 
-				if (cur_map->dirty_tiles_enable) {
+				if (skip_clean) {
 					if (cur_map->dirty_tiles[offset] == 0) continue;
 					cur_map->dirty_tiles[offset] = 0;
 				}
@@ -1200,7 +1734,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 				if (cur_map->flags & TMAP_FLIPY) {
 					// part of clip fix (save for reimpl)
 					//sy = ((cur_map->mheight - 1) * cur_map->theight) - sy;
-					sy = ((maxy - miny) - cur_map->theight) - sy;
+					sy = (flip_height - cur_map->theight) - sy;
 					flipy ^= TILE_FLIPY;
 				}
 
@@ -1333,7 +1867,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 		INT32 code, color, group, gfxnum, category = 0, offset = cur_map->pScan(col,row);
 		UINT32 flags;
 
-		if (cur_map->dirty_tiles_enable) {
+		if (skip_clean) {
 			if (cur_map->dirty_tiles[offset] == 0) continue;
 			cur_map->dirty_tiles[offset] = 0;
 		}
@@ -1411,7 +1945,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 		sy += cur_map->yoffset;
 
 		if (cur_map->flags & TMAP_FLIPY) {
-			sy = ((maxy - miny) - cur_map->theight) - sy;
+			sy = (flip_height - cur_map->theight) - sy;
 			flipy ^= TILE_FLIPY;
 		}
 
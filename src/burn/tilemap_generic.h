@@ -157,6 +157,13 @@ void GenericTilemapAllTilesDirty(INT32 which);
 // Is this tile dirty (note that offset will be %= map_height * map_width!!)
 INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset);
 
+// Keep the whole tilemap drawn out in memory and only draw tiles again when they change.
+// pTile is still called for the tiles on screen each draw to check, unless GenericTilemapUseDirtyTiles
+// is used as well, then only tiles marked dirty are checked (mark them all if a color bank changes).
+// Use GenericTilemapSetTileDirty/GenericTilemapAllTilesDirty if the tile graphics change.
+// Used for scrollx/scrolly and line scroll, other scrolling is drawn as usual.
+void GenericTilemapUseCache(INT32 which);
+
 // Actually draw the tilemap.
 // which 	- select which tilemap to draw
 // Bitmap	- pointer to the bitmap to draw the tilemap
@@ -17,9 +17,15 @@ Otherwise, use the Transfer code as usual.
 
 UINT8* pTileData;
 INT32 nScreenWidth, nScreenHeight;
-static INT32 nScreenWidthMax, nScreenHeightMax, nScreenWidthMin, nScreenHeightMin;
+static BURN_THREAD_LOCAL INT32 nScreenWidthMax, nScreenHeightMax, nScreenWidthMin, nScreenHeightMin;
 
-UINT8 GenericTilesPRIMASK = 0x00;
+BURN_THREAD_LOCAL UINT8 GenericTilesPRIMASK = 0x00;
+
+// The band this thread is drawing for GenericTilesDrawBands(), and the clip's lines as they'd be
+// without it
+static BURN_THREAD_LOCAL INT32 bBandDraw = 0;
+static BURN_THREAD_LOCAL INT32 nBandMinY, nBandMaxY;
+static BURN_THREAD_LOCAL INT32 nBandClipMinY, nBandClipMaxY;
 
 INT32 GenericTilesInit()
 {
@@ -50,6 +56,8 @@ INT32 GenericTilesInit()
 
 INT32 GenericTilesExit()
 {
+	BurnVideoPipelineExit();
+
 	nScreenWidth = nScreenHeight = 0;
 	nScreenWidthMax = nScreenHeightMax = 0;
 	nScreenHeightMin = nScreenWidthMin = 0;
@@ -65,6 +73,11 @@ INT32 GenericTilesExit()
 
 void GenericTilesSetClip(INT32 nMinx, INT32 nMaxx, INT32 nMiny, INT32 nMaxy)
 {
+	if (bBandDraw) {
+		nScreenHeightMin = nBandClipMinY;
+		nScreenHeightMax = nBandClipMaxY;
+	}
+
 	if (nMinx > -1) nScreenWidthMin = nMinx;
 	if (nMaxx > -1) nScreenWidthMax = nMaxx;
 	if (nMiny > -1) nScreenHeightMin = nMiny;
@@ -75,6 +88,15 @@ void GenericTilesSetClip(INT32 nMinx, INT32 nMaxx, INT32 nMiny, INT32 nMaxy)
 
 	if (nMaxx > nScreenWidth) nMaxx = nScreenWidth;
 	if (nMaxy > nScreenHeight) nMaxy = nScreenHeight;
+
+	if (bBandDraw) {
+		nBandClipMinY = nScreenHeightMin;
+		nBandClipMaxY = nScreenHeightMax;
+
+		if (nScreenHeightMin < nBandMinY) nScreenHeightMin = nBandMinY;
+		if (nScreenHeightMax > nBandMaxY) nScreenHeightMax = nBandMaxY;
+		if (nScreenHeightMax < nScreenHeightMin) nScreenHeightMax = nScreenHeightMin;
+	}
 }
 
 void GenericTilesGetClip(INT32 *nMinx, INT32 *nMaxx, INT32 *nMiny, INT32 *nMaxy)
@@ -91,6 +113,13 @@ void GenericTilesClearClip()
 	nScreenWidthMax = nScreenWidth;
 	nScreenHeightMin = 0;
 	nScreenHeightMax = nScreenHeight;
+
+	if (bBandDraw) {
+		nBandClipMinY = nScreenHeightMin;
+		nBandClipMaxY = nScreenHeightMax;
+		nScreenHeightMin = nBandMinY;
+		nScreenHeightMax = nBandMaxY;
+	}
 }
 
 void GenericTilesSetClipRaw(INT32 nMinx, INT32 nMaxx, INT32 nMiny, INT32 nMaxy)
@@ -125,8 +154,96 @@ void GenericTilesSetScanline(INT32 nScanline)
 
 	nScreenHeightMin = nScanline;
 	nScreenHeightMax = nScanline + 1;
+
+	if (bBandDraw) {
+		nBandClipMinY = nScreenHeightMin;
+		nBandClipMaxY = nScreenHeightMax;
+
+		if (nScanline < nBandMinY || nScanline >= nBandMaxY) {
+			nScreenHeightMax = nScreenHeightMin;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+// Drawing in bands
+
+#define BAND_MIN_HEIGHT		16		// don't bother splitting up less than this many lines a band
+
+static void (*pBandDrawFunc)() = NULL;
+static INT32 nBandCount;
+static INT32 nBandScreenClip[4];	// min x, max x, min y, max y of the clip when the bands were started
+static UINT8 nBandPRIMASK;
+
+static void GenericTilesDrawBand(INT32 nStart, INT32 nEnd, void* /*pParam*/)
+{
+	// the whole screen is split up, as pDraw can open the clip up again
+	for (INT32 i = nStart; i < nEnd; i++) {
+		nBandMinY = (nScreenHeight * i) / nBandCount;
+		nBandMaxY = (nScreenHeight * (i + 1)) / nBandCount;
+		bBandDraw = 1;
+
+		nScreenWidthMin = nBandScreenClip[0];
+		nScreenWidthMax = nBandScreenClip[1];
+		nBandClipMinY = nBandScreenClip[2];
+		nBandClipMaxY = nBandScreenClip[3];
+		GenericTilesSetClip(-1, -1, nBandScreenClip[2], nBandScreenClip[3]);
+		GenericTilesPRIMASK = nBandPRIMASK;
+
+		pBandDrawFunc();
+
+		bBandDraw = 0;
+	}
+}
+
+void GenericTilesDrawBands(void (*pDraw)())
+{
+	INT32 nBands = BurnThreadsCount();
+	if (nBands > nScreenHeight / BAND_MIN_HEIGHT) {
+		nBands = nScreenHeight / BAND_MIN_HEIGHT;
+	}
+
+	if (nBands < 2 || bBandDraw) {
+		pDraw();
+		return;
+	}
+
+	// the calling thread draws bands too, so keep its clip to put back afterwards
+	INT32 nClip[4] = { nScreenWidthMin, nScreenWidthMax, nScreenHeightMin, nScreenHeightMax };
+	UINT8 nPrimask = GenericTilesPRIMASK;
+
+	pBandDrawFunc = pDraw;
+	nBandCount = nBands;
+	memcpy (nBandScreenClip, nClip, sizeof(nClip));
+	nBandPRIMASK = nPrimask;
+
+	BurnParallelFor(nBands, 1, GenericTilesDrawBand, NULL);
+
+	nScreenWidthMin = nClip[0];
+	nScreenWidthMax = nClip[1];
+	nScreenHeightMin = nClip[2];
+	nScreenHeightMax = nClip[3];
+	GenericTilesPRIMASK = nPrimask;
+
+	pBandDrawFunc = NULL;
+}
+
+INT32 GenericTilesGetUnbandedClip(INT32 *nMinx, INT32 *nMaxx, INT32 *nMiny, INT32 *nMaxy)
+{
+	GenericTilesGetClip(nMinx, nMaxx, nMiny, nMaxy);
+
+	if (bBandDraw == 0) {
+		return 0;
+	}
+
+	*nMiny = nBandClipMinY;
+	*nMaxy = nBandClipMaxY;
+
+	return 1;
 }
 
+#undef BAND_MIN_HEIGHT
+
 // ----------------------------------------------------------------------------
 // Generic Tile Handling
 
@@ -143,6 +260,199 @@ UINT8 *pPrioDraw = NULL;
 
 static INT32 nTransWidth, nTransHeight;
 
+// Skipping unchanged rows (bBurnTransferDirtyRows)
+//
+// Drivers write pTransDraw directly in too many places to mark the rows they change, so instead a
+// copy of every row as it was last transferred is kept, and a row is skipped when it's the same
+// and the palette hasn't changed.  The frontend has to keep the image in pBurnDraw between frames.
+bool bBurnTransferDirtyRows = false;
+
+static UINT16* pTransShadow = NULL;				// rows as they were last transferred
+static UINT8* pTransShadowUntracked = NULL;		// rows using colours past the end of the tracked palette
+static UINT32* pTransPalShadow = NULL;
+static INT32 nTransPalShadowLen = 0;
+static bool bTransShadowValid = false;
+static UINT8* pTransLastDraw = NULL;
+static INT32 nTransLastPitch = 0;
+static INT32 nTransLastBpp = 0;
+static UINT32* pTransLastPalette = NULL;
+static INT32 nTransCopies = 0;					// BurnTransferCopy() calls since BurnTransferEndFrame()
+
+typedef void (*BurnTransferRowFn)(const UINT16* pSrc, UINT8* pDest, const UINT32* pPalette, INT32 nWidth);
+
+static void BurnTransferRow16(const UINT16* pSrc, UINT8* pDest, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT16* pDest16 = (UINT16*)pDest;
+	INT32 x = 0;
+
+	for (; x + 4 <= nWidth; x += 4) {
+		UINT32 c0 = pPalette[pSrc[x + 0]], c1 = pPalette[pSrc[x + 1]], c2 = pPalette[pSrc[x + 2]], c3 = pPalette[pSrc[x + 3]];
+		pDest16[x + 0] = c0; pDest16[x + 1] = c1; pDest16[x + 2] = c2; pDest16[x + 3] = c3;
+	}
+	for (; x < nWidth; x++) {
+		pDest16[x] = pPalette[pSrc[x]];
+	}
+}
+
+static void BurnTransferRow24(const UINT16* pSrc, UINT8* pDest, const UINT32* pPalette, INT32 nWidth)
+{
+	for (INT32 x = 0; x < nWidth; x++) {
+		UINT32 c = pPalette[pSrc[x]];
+		pDest[(x * 3) + 0] = c & 0xFF;
+		pDest[(x * 3) + 1] = (c >> 8) & 0xFF;
+		pDest[(x * 3) + 2] = c >> 16;
+	}
+}
+
+static void BurnTransferRow32(const UINT16* pSrc, UINT8* pDest, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT32* pDest32 = (UINT32*)pDest;
+	INT32 x = 0;
+
+	for (; x + 4 <= nWidth; x += 4) {
+		UINT32 c0 = pPalette[pSrc[x + 0]], c1 = pPalette[pSrc[x + 1]], c2 = pPalette[pSrc[x + 2]], c3 = pPalette[pSrc[x + 3]];
+		pDest32[x + 0] = c0; pDest32[x + 1] = c1; pDest32[x + 2] = c2; pDest32[x + 3] = c3;
+	}
+	for (; x < nWidth; x++) {
+		pDest32[x] = pPalette[pSrc[x]];
+	}
+}
+
+// AVX2 has a gather instruction, which does 8 palette lookups at once
+#if defined (__GNUC__) && (__GNUC__ >= 5 || defined (__clang__)) && (defined (__x86_64__) || defined (__i386__))
+ #define BURN_TRANSFER_AVX2
+ #include <immintrin.h>
+
+__attribute__((target("avx2"))) static void BurnTransferRow16AVX2(const UINT16* pSrc, UINT8* pDest, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT16* pDest16 = (UINT16*)pDest;
+	INT32 x = 0;
+
+	// the scalar loop keeps the low 16 bits, so mask them off before the saturating pack
+	const __m256i m = _mm256_set1_epi32(0xffff);
+
+	for (; x + 16 <= nWidth; x += 16) {
+		__m256i i0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pSrc + x + 0)));
+		__m256i i1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pSrc + x + 8)));
+		__m256i c0 = _mm256_i32gather_epi32((const int*)pPalette, i0, 4);
+		__m256i c1 = _mm256_i32gather_epi32((const int*)pPalette, i1, 4);
+		c0 = _mm256_and_si256(c0, m);
+		c1 = _mm256_and_si256(c1, m);
+		__m256i c = _mm256_permute4x64_epi64(_mm256_packus_epi32(c0, c1), 0xd8);	// pack works within 128-bit lanes
+		_mm256_storeu_si256((__m256i*)(pDest16 + x), c);
+	}
+	for (; x < nWidth; x++) {
+		pDest16[x] = pPalette[pSrc[x]];
+	}
+}
+
+__attribute__((target("avx2"))) static void BurnTransferRow32AVX2(const UINT16* pSrc, UINT8* pDest, const UINT32* pPalette, INT32 nWidth)
+{
+	UINT32* pDest32 = (UINT32*)pDest;
+	INT32 x = 0;
+
+	for (; x + 8 <= nWidth; x += 8) {
+		__m256i i = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(pSrc + x)));
+		_mm256_storeu_si256((__m256i*)(pDest32 + x), _mm256_i32gather_epi32((const int*)pPalette, i, 4));
+	}
+	for (; x < nWidth; x++) {
+		pDest32[x] = pPalette[pSrc[x]];
+	}
+}
+
+static bool BurnTransferHaveAVX2()
+{
+	static INT32 nHave = -1;
+
+	if (nHave < 0) {
+		__builtin_cpu_init();
+		nHave = __builtin_cpu_supports("avx2") ? 1 : 0;
+	}
+
+	return nHave;
+}
+#endif
+
+static BurnTransferRowFn BurnTransferGetRowFn()
+{
+	switch (nBurnBpp) {
+		case 2:
+#if defined (BURN_TRANSFER_AVX2)
+			if (BurnTransferHaveAVX2()) return BurnTransferRow16AVX2;
+#endif
+			return BurnTransferRow16;
+		case 3:
+			return BurnTransferRow24;
+		case 4:
+#if defined (BURN_TRANSFER_AVX2)
+			if (BurnTransferHaveAVX2()) return BurnTransferRow32AVX2;
+#endif
+			return BurnTransferRow32;
+	}
+
+	return NULL;
+}
+
+static void BurnTransferShadowExit()
+{
+	BurnFree(pTransShadow);
+	BurnFree(pTransShadowUntracked);
+	BurnFree(pTransPalShadow);
+	nTransPalShadowLen = 0;
+	bTransShadowValid = false;
+}
+
+// Call after drawing over pBurnDraw without BurnTransferCopy(), so the next transfer redoes every row
+void BurnTransferInvalidate()
+{
+	bTransShadowValid = false;
+}
+
+// Called after each frame, catches drivers that sometimes draw pBurnDraw themselves (blending etc.)
+void BurnTransferEndFrame()
+{
+	if (pBurnDraw && nTransCopies != 1) {
+		bTransShadowValid = false;
+	}
+
+	nTransCopies = 0;
+}
+
+// Returns true if unchanged rows can be skipped this time
+static bool BurnTransferShadowCheck(UINT32* pPalette)
+{
+	if (pTransShadow == NULL) {
+		nTransPalShadowLen = BurnDrvGetPaletteEntries();
+		if (nTransPalShadowLen <= 0) {
+			return false;
+		}
+
+		pTransShadow = (UINT16*)BurnMalloc(nTransWidth * nTransHeight * sizeof(UINT16));
+		pTransShadowUntracked = (UINT8*)BurnMalloc(nTransHeight);
+		pTransPalShadow = (UINT32*)BurnMalloc(nTransPalShadowLen * sizeof(UINT32));
+		if (pTransShadow == NULL || pTransShadowUntracked == NULL || pTransPalShadow == NULL) {
+			BurnTransferShadowExit();
+			return false;
+		}
+		bTransShadowValid = false;
+	}
+
+	bool bValid = bTransShadowValid && pBurnDraw == pTransLastDraw && nBurnPitch == nTransLastPitch && nBurnBpp == nTransLastBpp && pPalette == pTransLastPalette;
+
+	if (memcmp(pTransPalShadow, pPalette, nTransPalShadowLen * sizeof(UINT32))) {
+		memcpy(pTransPalShadow, pPalette, nTransPalShadowLen * sizeof(UINT32));
+		bValid = false;
+	}
+
+	pTransLastDraw = pBurnDraw;
+	nTransLastPitch = nBurnPitch;
+	nTransLastBpp = nBurnBpp;
+	pTransLastPalette = pPalette;
+	bTransShadowValid = true;
+
+	return bValid;
+}
+
 void BurnTransferClear()
 {
 #if defined FBNEO_DEBUG
@@ -177,6 +487,8 @@ void BurnTransferClear(UINT16 nFillPattern)
 
 INT32 BurnTransferCopy(UINT32* pPalette)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_TRANSFER);
+
 #if defined FBNEO_DEBUG
 	if (!Debug_BurnTransferInitted) bprintf(PRINT_ERROR, _T("BurnTransferCopy called without init\n"));
 #endif
@@ -185,36 +497,50 @@ INT32 BurnTransferCopy(UINT32* pPalette)
 	UINT8* pDest = pBurnDraw;
 
 	pBurnDrvPalette = pPalette;
+	nTransCopies++;
 
-	switch (nBurnBpp) {
-		case 2: {
-			for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
-				for (INT32 x = 0; x < nTransWidth; x ++) {
-					((UINT16*)pDest)[x] = pPalette[pSrc[x]];
-				}
-			}
-			break;
+	BurnTransferRowFn pRowFn = BurnTransferGetRowFn();
+	if (pRowFn == NULL) {
+		return 0;
+	}
+
+	if (!bBurnTransferDirtyRows) {
+		if (pTransShadow) {
+			BurnTransferShadowExit();
 		}
-		case 3: {
-			for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
-				for (INT32 x = 0; x < nTransWidth; x++) {
-					UINT32 c = pPalette[pSrc[x]];
-					*(pDest + (x * 3) + 0) = c & 0xFF;
-					*(pDest + (x * 3) + 1) = (c >> 8) & 0xFF;
-					*(pDest + (x * 3) + 2) = c >> 16;
 
-				}
-			}
-			break;
+		for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
+			pRowFn(pSrc, pDest, pPalette, nTransWidth);
 		}
-		case 4: {
-			for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
-				for (INT32 x = 0; x < nTransWidth; x++) {
-					((UINT32*)pDest)[x] = pPalette[pSrc[x]];
-				}
-			}
-			break;
+
+		return 0;
+	}
+
+	bool bSkip = BurnTransferShadowCheck(pPalette);
+	if (pTransShadow == NULL) {
+		for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch) {
+			pRowFn(pSrc, pDest, pPalette, nTransWidth);
 		}
+
+		return 0;
+	}
+
+	UINT16* pShadow = pTransShadow;
+
+	for (INT32 y = 0; y < nTransHeight; y++, pSrc += nTransWidth, pDest += nBurnPitch, pShadow += nTransWidth) {
+		if (bSkip && !pTransShadowUntracked[y] && memcmp(pSrc, pShadow, nTransWidth * sizeof(UINT16)) == 0) {
+			continue;
+		}
+
+		pRowFn(pSrc, pDest, pPalette, nTransWidth);
+
+		UINT16 nMax = 0;
+		for (INT32 x = 0; x < nTransWidth; x++) {
+			nMax |= pSrc[x];
+		}
+		pTransShadowUntracked[y] = (nMax >= nTransPalShadowLen);	// a bit pessimistic, but cheap
+
+		memcpy(pShadow, pSrc, nTransWidth * sizeof(UINT16));
 	}
 
 	return 0;
@@ -226,6 +552,8 @@ void BurnTransferExit()
 	if (!Debug_BurnTransferInitted) bprintf(PRINT_ERROR, _T("BurnTransferExit called without init\n"));
 #endif
 
+	BurnTransferShadowExit();
+
 	BurnBitmapExit();
 	pTransDraw = NULL;
 	pPrioDraw = NULL;
@@ -235,12 +563,122 @@ void BurnTransferExit()
 	Debug_BurnTransferInitted = 0;
 }
 
+// ----------------------------------------------------------------------------
+// Pipelined drawing
+
+bool bBurnVideoPipeline = false;
+
+#define PIPE_IDLE		0		// nothing drawn for the last frame
+#define PIPE_DRAWN		1		// pTransDraw has the last frame, drawn without the pipeline
+#define PIPE_RENDERING	2		// the last frame is being drawn on the render thread
+
+static void (*pPipeSnapshot)() = NULL;
+static void (*pPipeRender)() = NULL;
+static UINT32* pPipePalette = NULL;
+static INT32 nPipeState = PIPE_IDLE;
+static bool bPipeFrame = false;		// BurnVideoPipelineFrame() has been called this frame
+static INT32 nPipeClip[4];
+
+static void BurnVideoPipelineRender(INT32 /*nStart*/, INT32 /*nEnd*/, void* /*pParam*/)
+{
+	// the clip is per thread, so give the render thread the emulation thread's one
+	GenericTilesSetClip(nPipeClip[0], nPipeClip[1], nPipeClip[2], nPipeClip[3]);
+
+	pPipeRender();
+}
+
+static void BurnVideoPipelineSync()
+{
+	if (nPipeState == PIPE_RENDERING) {
+		BurnThreadAsyncWait();
+	}
+
+	nPipeState = PIPE_IDLE;
+}
+
+void BurnVideoPipelineInit(void (*pSnapshot)(), void (*pRender)(), UINT32* pPalette)
+{
+	BurnVideoPipelineSync();
+
+	pPipeSnapshot = pSnapshot;
+	pPipeRender = pRender;
+	pPipePalette = pPalette;
+	bPipeFrame = false;
+}
+
+void BurnVideoPipelineExit()
+{
+	BurnVideoPipelineSync();
+
+	pPipeSnapshot = NULL;
+	pPipeRender = NULL;
+	pPipePalette = NULL;
+}
+
+INT32 BurnVideoPipelineDraw()
+{
+	BurnVideoPipelineSync();
+
+	pPipeSnapshot();
+	pPipeRender();
+	BurnTransferCopy(pPipePalette);
+
+	return 0;
+}
+
+INT32 BurnVideoPipelineFrame()
+{
+	if (!bBurnVideoPipeline || BurnThreadsCount() < 2) {
+		return BurnVideoPipelineDraw();
+	}
+
+	bPipeFrame = true;
+
+	// starting up, show this frame now and the next one shows it again, then each shows the last
+	if (nPipeState == PIPE_IDLE) {
+		BurnVideoPipelineDraw();
+		nPipeState = PIPE_DRAWN;
+		return 0;
+	}
+
+	if (nPipeState == PIPE_RENDERING) {
+		BurnThreadAsyncWait();
+	}
+
+	BurnTransferCopy(pPipePalette);
+
+	pPipeSnapshot();
+	GenericTilesGetClip(&nPipeClip[0], &nPipeClip[1], &nPipeClip[2], &nPipeClip[3]);
+
+	nPipeState = PIPE_RENDERING;
+	BurnThreadAsync(BurnVideoPipelineRender, NULL);
+
+	return 0;
+}
+
+void BurnVideoPipelineEndFrame()
+{
+	// a frame that wasn't drawn (skipped) breaks the chain, start again with the next one
+	if (!bPipeFrame && nPipeState != PIPE_IDLE) {
+		BurnVideoPipelineSync();
+	}
+
+	bPipeFrame = false;
+}
+
+#undef PIPE_IDLE
+#undef PIPE_DRAWN
+#undef PIPE_RENDERING
+
 #define nTransOverflow 10 // 10 lines of overflow, some games spill past the end of the allocated height causing heap corruption.
 
 INT32 BurnTransferInit()
 {
 	Debug_BurnTransferInitted = 1;
 
+	BurnTransferShadowExit();
+	nTransCopies = 0;
+
 	if (BurnDrvGetFlags() & BDF_ORIENTATION_VERTICAL) {
 		BurnDrvGetVisibleSize(&nTransHeight, &nTransWidth);
 	} else {
@@ -259,37 +697,190 @@ INT32 BurnTransferInit()
 
 /*================================================================================================
 Graphics Decoding
+
+The bit offset of every pixel in a tile (yoffsets[y] + xoffsets[x]) is worked out once per call
+rather than once per tile.  Two common layouts get faster paths:
+ - each plane of each group of 8 pixels is one whole byte: a table turns the byte into 8 pixels
+ - the planes of a pixel are next to each other (packed pixels): all of them are read at once
+Large decodes are split across the worker threads (see burn_threads.h).
 ================================================================================================*/
 
+#define GFXDECODE_BITS				0	// anything else, one bit at a time
+#define GFXDECODE_BYTES				1
+#define GFXDECODE_PACKED			2
+
+#define GFXDECODE_THREAD_PIXELS		(0x40000)	// smaller decodes aren't worth waking the threads for
+
+struct GfxDecodeInfo {
+	INT32 nMode;
+	INT32 numPlanes, xSize, ySize, modulo;
+	INT32 *planeoffsets;
+	INT32 *pOffsets;		// bit offset of each pixel within a plane, or of each group of 8 pixels (GFXDECODE_BYTES)
+	UINT8 *pSrc, *pDest;
+};
+
+static UINT64 GfxDecodeExpand[256];		// byte -> 8 pixels, 0 or 1 each, in memory order
+static bool bGfxDecodeExpand = false;
+
 inline static INT32 readbit(const UINT8 *src, INT32 bitnum)
 {
 	return src[bitnum / 8] & (0x80 >> (bitnum % 8));
 }
 
+// Read nBits (up to 8) starting at bit nBit, the first bit is the most significant
+inline static INT32 readbits(const UINT8 *src, INT32 nBit, INT32 nBits)
+{
+	const UINT8 *p = src + (nBit >> 3);
+	INT32 nShift = 8 - (nBit & 7) - nBits;
+
+	if (nShift >= 0) {
+		return (p[0] >> nShift) & ((1 << nBits) - 1);
+	}
+
+	return (((p[0] << 8) | p[1]) >> (nShift + 8)) & ((1 << nBits) - 1);
+}
+
+static void GfxDecodeTiles(INT32 nStart, INT32 nEnd, void* pParam)
+{
+	struct GfxDecodeInfo *pgi = (struct GfxDecodeInfo*)pParam;
+
+	const INT32 numPlanes = pgi->numPlanes;
+	const INT32 nTileSize = pgi->xSize * pgi->ySize;
+	const INT32 *pOffsets = pgi->pOffsets;
+	const UINT8 *pSrc = pgi->pSrc;
+
+	for (INT32 c = nStart; c < nEnd; c++) {
+		UINT8 *dp = pgi->pDest + (c * nTileSize);
+
+		switch (pgi->nMode) {
+			case GFXDECODE_BYTES: {
+				const INT32 nGroups = nTileSize / 8;
+
+				memset(dp, 0, nTileSize);
+
+				for (INT32 plane = 0; plane < numPlanes; plane++) {
+					const UINT64 planebit = 1 << (numPlanes - 1 - plane);
+					const UINT8 *sp = pSrc + (((c * pgi->modulo) + pgi->planeoffsets[plane]) >> 3);
+
+					for (INT32 i = 0; i < nGroups; i++) {
+						UINT64 d;
+						memcpy(&d, dp + i * 8, sizeof(d));
+						d |= GfxDecodeExpand[sp[pOffsets[i]]] * planebit;
+						memcpy(dp + i * 8, &d, sizeof(d));
+					}
+				}
+				break;
+			}
+
+			case GFXDECODE_PACKED: {
+				const INT32 nBase = (c * pgi->modulo) + pgi->planeoffsets[0];
+
+				for (INT32 i = 0; i < nTileSize; i++) {
+					dp[i] = readbits(pSrc, nBase + pOffsets[i], numPlanes);
+				}
+				break;
+			}
+
+			default: {
+				memset(dp, 0, nTileSize);
+
+				for (INT32 plane = 0; plane < numPlanes; plane++) {
+					const INT32 planebit = 1 << (numPlanes - 1 - plane);
+					const INT32 planeoffs = (c * pgi->modulo) + pgi->planeoffsets[plane];
+
+					for (INT32 i = 0; i < nTileSize; i++) {
+						if (readbit(pSrc, planeoffs + pOffsets[i])) dp[i] |= planebit;
+					}
+				}
+				break;
+			}
+		}
+	}
+}
+
 void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
-	INT32 c;
+	struct GfxDecodeInfo gi;
+
+	if (num <= 0 || xSize <= 0 || ySize <= 0) {
+		return;
+	}
 
-	for (c = 0; c < num; c++) {
-		INT32 plane, x, y;
+	gi.nMode = GFXDECODE_BITS;
+	gi.numPlanes = numPlanes;
+	gi.xSize = xSize;
+	gi.ySize = ySize;
+	gi.modulo = modulo;
+	gi.planeoffsets = planeoffsets;
+	gi.pSrc = pSrc;
+	gi.pDest = pDest;
+
+	gi.pOffsets = (INT32*)malloc(xSize * ySize * sizeof(INT32));
+	if (gi.pOffsets == NULL) {
+		return;
+	}
 
-		UINT8 *dp = pDest + (c * xSize * ySize);
-		memset(dp, 0, xSize * ySize);
+	for (INT32 y = 0; y < ySize; y++) {
+		for (INT32 x = 0; x < xSize; x++) {
+			gi.pOffsets[y * xSize + x] = yoffsets[y] + xoffsets[x];
+		}
+	}
 
-		for (plane = 0; plane < numPlanes; plane++) {
-			INT32 planebit = 1 << (numPlanes - 1 - plane);
-			INT32 planeoffs = (c * modulo) + planeoffsets[plane];
+	// Packed pixels, the planes are consecutive bits
+	bool bPacked = (numPlanes > 1 && numPlanes <= 8);
+	for (INT32 plane = 1; bPacked && plane < numPlanes; plane++) {
+		if (planeoffsets[plane] != planeoffsets[0] + plane) {
+			bPacked = false;
+		}
+	}
 
-			for (y = 0; y < ySize; y++) {
-				INT32 yoffs = planeoffs + yoffsets[y];
-				dp = pDest + (c * xSize * ySize) + (y * xSize);
+	// Bytes, every 8 pixels of a row are 8 consecutive bits starting on a byte
+	bool bBytes = (numPlanes <= 8 && (xSize & 7) == 0 && (modulo & 7) == 0);
+	for (INT32 plane = 0; bBytes && plane < numPlanes; plane++) {
+		if (planeoffsets[plane] & 7) {
+			bBytes = false;
+		}
+	}
+	for (INT32 i = 0; bBytes && i < xSize * ySize; i += 8) {
+		if (gi.pOffsets[i] & 7) {
+			bBytes = false;
+		}
+		for (INT32 j = 1; j < 8; j++) {
+			if (gi.pOffsets[i + j] != gi.pOffsets[i] + j) {
+				bBytes = false;
+			}
+		}
+	}
 
-				for (x = 0; x < xSize; x++) {
-					if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
+	if (bBytes) {
+		if (!bGfxDecodeExpand) {
+			for (INT32 i = 0; i < 256; i++) {
+				UINT8 nPixels[8];
+				for (INT32 j = 0; j < 8; j++) {
+					nPixels[j] = (i >> (7 - j)) & 1;
 				}
+				memcpy(&GfxDecodeExpand[i], nPixels, sizeof(nPixels));
 			}
+			bGfxDecodeExpand = true;
+		}
+
+		// Byte offset of each group of 8 pixels
+		for (INT32 i = 0; i < xSize * ySize / 8; i++) {
+			gi.pOffsets[i] = gi.pOffsets[i * 8] >> 3;
 		}
+
+		gi.nMode = GFXDECODE_BYTES;
+	} else if (bPacked) {
+		gi.nMode = GFXDECODE_PACKED;
+	}
+
+	if (num * xSize * ySize >= GFXDECODE_THREAD_PIXELS) {
+		BurnParallelFor(num, 16, GfxDecodeTiles, &gi);
+	} else {
+		GfxDecodeTiles(0, num, &gi);
 	}
+
+	free(gi.pOffsets);
 }
 
 void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
@@ -314,431 +905,248 @@ void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT
 	}
 }
 
-//================================================================================================
-
-#define PLOTPIXEL_PRIO(x) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_FLIPX(x, a) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_MASK(x, mc) if (pTileData[x] != mc) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
+/*================================================================================================
+Tile Rendering
 
-#define PLOTPIXEL(x) pPixel[x] = nPalette + pTileData[x];
-#define PLOTPIXEL_FLIPX(x, a) pPixel[x] = nPalette + pTileData[a];
-#define PLOTPIXEL_MASK(x, mc) if (pTileData[x] != mc) {pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) {pPixel[x] = nPalette + pTileData[a] ;}
+All of the Render*Tile* functions below are instances of RenderTile<>, which gets the tile size
+and what the variants differ in (flipping, clipping, masking, priority) as template parameters.
+Clipping is worked out once per tile as a range of rows and columns, so the inner loops only test
+for transparency, and they draw 8 pixels at a time with SSE2 or NEON where there's one.
+================================================================================================*/
 
-#define PLOTPIXEL_PRIO_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a] ;}
+#define RT_FLIPX		(1 << 0)
+#define RT_FLIPY		(1 << 1)
+#define RT_CLIP			(1 << 2)
+#define RT_MASK			(1 << 3)		// pixels of nMaskColour aren't drawn
+#define RT_TRANSMASK	(1 << 4)		// pixels with a non-zero entry in pTransTable aren't drawn
+#define RT_PRIO			(1 << 5)		// drawn pixels set pPrioDraw to nPriority
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define RENDER_TILE_SSE2
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+ #define RENDER_TILE_NEON
+ #include <arm_neon.h>
+#endif
+
+// Draw columns nStart to nEnd of a row, pSrc is the row of the tile as it is in the graphics
+template <INT32 nFlags>
+static inline void RenderTileRow(UINT16* pPixel, UINT8* pPri, const UINT8* pSrc, INT32 nStart, INT32 nEnd, INT32 nWidth, UINT32 nPalette, INT32 nMaskColour, const UINT8* pTransTable, UINT8 nPriority)
+{
+	INT32 x = nStart;
+
+#if defined (RENDER_TILE_SSE2)
+	if ((nFlags & RT_TRANSMASK) == 0) {
+		const __m128i vZero = _mm_setzero_si128();
+		const __m128i vPalette = _mm_set1_epi16((INT16)nPalette);
+		const __m128i vMask = _mm_set1_epi16(((UINT32)nMaskColour < 0x100) ? nMaskColour : -1);
+		const __m128i vPriMask = _mm_set1_epi8(GenericTilesPRIMASK);
+		const __m128i vPriority = _mm_set1_epi8(nPriority);
+
+		for (; x + 8 <= nEnd; x += 8) {
+			__m128i s;
+			if (nFlags & RT_FLIPX) {
+				s = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(pSrc + nWidth - 8 - x)), vZero);
+				s = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0x1b), 0x1b), 0x4e);
+			} else {
+				s = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(pSrc + x)), vZero);
+			}
+
+			__m128i c = _mm_add_epi16(s, vPalette);
+
+			if (nFlags & RT_MASK) {
+				__m128i m = _mm_cmpeq_epi16(s, vMask);
+				if (_mm_movemask_epi8(m) == 0xffff) {
+					continue;
+				}
 
-#define CLIPPIXEL(x, sx, a) if ((sx + x) >= nScreenWidthMin && (sx + x) < nScreenWidthMax) { a; };
+				__m128i d = _mm_loadu_si128((__m128i*)(pPixel + x));
+				_mm_storeu_si128((__m128i*)(pPixel + x), _mm_or_si128(_mm_and_si128(m, d), _mm_andnot_si128(m, c)));
 
-/*================================================================================================
-8 x 8 Functions
-================================================================================================*/
+				if (nFlags & RT_PRIO) {
+					__m128i m8 = _mm_packs_epi16(m, m);
+					__m128i p = _mm_loadl_epi64((__m128i*)(pPri + x));
+					__m128i n = _mm_or_si128(_mm_and_si128(p, vPriMask), vPriority);
+					_mm_storel_epi64((__m128i*)(pPri + x), _mm_or_si128(_mm_and_si128(m8, p), _mm_andnot_si128(m8, n)));
+				}
+			} else {
+				_mm_storeu_si128((__m128i*)(pPixel + x), c);
 
-void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
-#endif
+				if (nFlags & RT_PRIO) {
+					__m128i p = _mm_loadl_epi64((__m128i*)(pPri + x));
+					_mm_storel_epi64((__m128i*)(pPri + x), _mm_or_si128(_mm_and_si128(p, vPriMask), vPriority));
+				}
+			}
+		}
+	}
+#elif defined (RENDER_TILE_NEON)
+	if ((nFlags & RT_TRANSMASK) == 0) {
+		const uint16x8_t vPalette = vdupq_n_u16((UINT16)nPalette);
+		const uint16x8_t vMask = vdupq_n_u16(((UINT32)nMaskColour < 0x100) ? nMaskColour : 0xffff);
+		const uint8x8_t vPriMask = vdup_n_u8(GenericTilesPRIMASK);
+		const uint8x8_t vPriority = vdup_n_u8(nPriority);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+		for (; x + 8 <= nEnd; x += 8) {
+			uint16x8_t s;
+			if (nFlags & RT_FLIPX) {
+				s = vmovl_u8(vrev64_u8(vld1_u8(pSrc + nWidth - 8 - x)));
+			} else {
+				s = vmovl_u8(vld1_u8(pSrc + x));
+			}
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+			uint16x8_t c = vaddq_u16(s, vPalette);
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
-	}
-}
+			if (nFlags & RT_MASK) {
+				uint16x8_t m = vceqq_u16(s, vMask);
+				vst1q_u16(pPixel + x, vbslq_u16(m, vld1q_u16(pPixel + x), c));
 
-void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Clip called without init\n"));
+				if (nFlags & RT_PRIO) {
+					uint8x8_t p = vld1_u8(pPri + x);
+					vst1_u8(pPri + x, vbsl_u8(vmovn_u16(m), p, vorr_u8(vand_u8(p, vPriMask), vPriority)));
+				}
+			} else {
+				vst1q_u16(pPixel + x, c);
+
+				if (nFlags & RT_PRIO) {
+					vst1_u8(pPri + x, vorr_u8(vand_u8(vld1_u8(pPri + x), vPriMask), vPriority));
+				}
+			}
+		}
+	}
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	for (; x < nEnd; x++) {
+		INT32 nColour = (nFlags & RT_FLIPX) ? pSrc[nWidth - 1 - x] : pSrc[x];
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+		if ((nFlags & RT_MASK) && nColour == nMaskColour) continue;
+		if ((nFlags & RT_TRANSMASK) && pTransTable[nColour]) continue;
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+		pPixel[x] = nPalette + nColour;
+		if (nFlags & RT_PRIO) {
+			pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK);
 		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
 	}
 }
 
-void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+// nSize is the width and height of the tile, or 0 to use nWidth and nHeight
+template <INT32 nSize, INT32 nFlags>
+static inline void RenderTile(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, UINT8* pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8* pTile)
 {
 #if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX called without init\n"));
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render tile function called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
+	if (nSize) {
+		nWidth = nHeight = nSize;
 	}
-}
-
-void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX_Clip called without init\n"));
-#endif
 
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	const UINT8* pSrc = pTile + (nTileNumber * nWidth * nHeight);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+	INT32 nMinX = 0, nMaxX = nWidth;
+	INT32 nMinY = 0, nMaxY = nHeight;
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+	if (nFlags & RT_CLIP) {
+		if (StartX < nScreenWidthMin) nMinX = nScreenWidthMin - StartX;
+		if (StartX + nWidth > nScreenWidthMax) nMaxX = nScreenWidthMax - StartX;
+		if (StartY < nScreenHeightMin) nMinY = nScreenHeightMin - StartY;
+		if (StartY + nHeight > nScreenHeightMax) nMaxY = nScreenHeightMax - StartY;
+
+		if (nMinX >= nMaxX || nMinY >= nMaxY) {
+			return;
 		}
+	}
 
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
+	for (INT32 y = nMinY; y < nMaxY; y++) {
+		const UINT8* pRow = pSrc + (((nFlags & RT_FLIPY) ? (nHeight - 1 - y) : y) * nWidth);
+		INT32 nOffset = ((StartY + y) * nScreenWidth) + StartX;
+
+		RenderTileRow<nFlags>(pDestDraw + nOffset, (nFlags & RT_PRIO) ? (pPrioDraw + nOffset) : NULL, pRow, nMinX, nMaxX, nWidth, nPalette, nMaskColour, pTransTable, nPriority);
 	}
 }
 
-void Render8x8Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY called without init\n"));
-#endif
+/*================================================================================================
+8 x 8 Functions
+================================================================================================*/
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
-	}
+void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, 0>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
-void Render8x8Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY_Clip called without init\n"));
-#endif
+	RenderTile<8, RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
+}
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, RT_FLIPX>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
+}
 
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
+void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, RT_FLIPX | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
+}
 
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+void Render8x8Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, RT_FLIPY>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
+}
 
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
-	}
+void Render8x8Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+	RenderTile<8, RT_FLIPY | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
-/*================================================================================================
-8 x 8 Functions with Masking
-================================================================================================*/
-
 void Render8x8Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
+	RenderTile<8, RT_MASK>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
-	}
+	RenderTile<8, RT_MASK | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, RT_FLIPX | RT_MASK>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, RT_FLIPX | RT_MASK | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
+	RenderTile<8, RT_FLIPY | RT_MASK>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
-	}
+	RenderTile<8, RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_MASK>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 /*================================================================================================
@@ -747,534 +1155,82 @@ void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 
 void Render16x16Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-	}
+	RenderTile<16, 0>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-	}
+	RenderTile<16, RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
-	}
+	RenderTile<16, RT_FLIPX>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
-	}
+	RenderTile<16, RT_FLIPX | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-	}
+	RenderTile<16, RT_FLIPY>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-	}
+	RenderTile<16, RT_FLIPY | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
-/*================================================================================================
-16 x 16 Functions with Masking
-================================================================================================*/
-
 void Render16x16Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
+	RenderTile<16, RT_MASK>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
+	RenderTile<16, RT_MASK | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, RT_FLIPX | RT_MASK>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, RT_FLIPX | RT_MASK | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
+	RenderTile<16, RT_FLIPY | RT_MASK>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
+	RenderTile<16, RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_MASK>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 /*================================================================================================
@@ -1283,790 +1239,82 @@ void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 
 void Render32x32Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
+	RenderTile<32, 0>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
+	RenderTile<32, RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
+	RenderTile<32, RT_FLIPX>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
+	RenderTile<32, RT_FLIPX | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
+	RenderTile<32, RT_FLIPY>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
+	RenderTile<32, RT_FLIPY | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
-/*================================================================================================
-32 x 32 Functions with Masking
-================================================================================================*/
-
 void Render32x32Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
+	RenderTile<32, RT_MASK>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
+	RenderTile<32, RT_MASK | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, RT_FLIPX | RT_MASK>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, RT_FLIPX | RT_MASK | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
+	RenderTile<32, RT_FLIPY | RT_MASK>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
+	RenderTile<32, RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_MASK>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void Render32x32Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 /*================================================================================================
@@ -2075,2646 +1323,466 @@ Custom Height and Width Functions
 
 void RenderCustomTile(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
+	RenderTile<0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
+	RenderTile<0, RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, RT_FLIPX>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
+	RenderTile<0, RT_FLIPY>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, 0, pTile);
 }
 
-/*================================================================================================
-Custom Height and Width Functions with Masking
-================================================================================================*/
-
 void RenderCustomTile_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_MASK>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_MASK | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_MASK>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_MASK | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_MASK>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_MASK>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
 void RenderCustomTile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_MASK | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, 0, pTile);
 }
 
-
+/*================================================================================================
+8 x 8 Functions with Priority
+================================================================================================*/
 
 void Render8x8Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
+	RenderTile<8, RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
+	RenderTile<8, RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
+	RenderTile<8, RT_FLIPX | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
+	RenderTile<8, RT_FLIPX | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
+	RenderTile<8, RT_FLIPY | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
+	RenderTile<8, RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw+ ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
-/*================================================================================================
-8 x 8 Functions with Masking
-================================================================================================*/
-
 void Render8x8Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
+	RenderTile<8, RT_MASK | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
+	RenderTile<8, RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, RT_FLIPX | RT_MASK | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, RT_FLIPX | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
+	RenderTile<8, RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
+	RenderTile<8, RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<8, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 /*================================================================================================
-16 x 16 Functions
+16 x 16 Functions with Priority
 ================================================================================================*/
 
 void Render16x16Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
+	RenderTile<16, RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
+	RenderTile<16, RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
+	RenderTile<16, RT_FLIPX | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
+	RenderTile<16, RT_FLIPX | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
+	RenderTile<16, RT_FLIPY | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
+	RenderTile<16, RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
-/*================================================================================================
-16 x 16 Functions with Masking
-================================================================================================*/
-
 void Render16x16Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
+	RenderTile<16, RT_MASK | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
+	RenderTile<16, RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, RT_FLIPX | RT_MASK | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, RT_FLIPX | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
+	RenderTile<16, RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
+	RenderTile<16, RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<16, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 /*================================================================================================
-32 x 32 Functions
+32 x 32 Functions with Priority
 ================================================================================================*/
 
 void Render32x32Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
+	RenderTile<32, RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
+	RenderTile<32, RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
+	RenderTile<32, RT_FLIPX | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
+	RenderTile<32, RT_FLIPX | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
+	RenderTile<32, RT_FLIPY | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
+	RenderTile<32, RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
-/*================================================================================================
-32 x 32 Functions with Masking
-================================================================================================*/
-
 void Render32x32Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
+	RenderTile<32, RT_MASK | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
+	RenderTile<32, RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, RT_FLIPX | RT_MASK | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, RT_FLIPX | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
+	RenderTile<32, RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
+	RenderTile<32, RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<32, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 /*================================================================================================
-Custom Height and Width Functions
+Custom Height and Width Functions with Priority
 ================================================================================================*/
 
 void RenderCustomTile_Prio(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
+	RenderTile<0, RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
-		}
-	}
+	RenderTile<0, RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, NULL, nPaletteOffset, nPriority, pTile);
 }
 
-/*================================================================================================
-Custom Height and Width Functions with Masking
-================================================================================================*/
-
 void RenderCustomTile_Prio_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_MASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_MASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_MASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, NULL, nPaletteOffset, nPriority, pTile);
 }
 
-
-
-
-
-
-
-
-
 void RenderCustomTile_Prio_TransMask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
+	RenderTile<0, RT_TRANSMASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
-	}
+	RenderTile<0, RT_TRANSMASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_TRANSMASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_TRANSMASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_TRANSMASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
-	}
+	RenderTile<0, RT_FLIPY | RT_TRANSMASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_TRANSMASK | RT_PRIO>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<0, RT_FLIPX | RT_FLIPY | RT_TRANSMASK | RT_PRIO | RT_CLIP>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, pTransTable, nPaletteOffset, nPriority, pTile);
 }
 
-
-
-#undef PLOTPIXEL_PRIO_TRANSMASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
-#undef PLOTPIXEL_TRANSMASK
-#undef PLOTPIXEL_TRANSMASK_FLIPX
-
-#undef PLOTPIXEL
-#undef PLOTPIXEL_FLIPX
-#undef PLOTPIXEL_MASK
-#undef CLIPPIXEL
-
-#undef PLOTPIXEL_PRIO
-#undef PLOTPIXEL_PRIO_FLIPX
-#undef PLOTPIXEL_PRIO_MASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
+#undef RT_FLIPX
+#undef RT_FLIPY
+#undef RT_CLIP
+#undef RT_MASK
+#undef RT_TRANSMASK
+#undef RT_PRIO
 
 /*================================================================================================
 Merged tile functions (flipping/clipping merged)
@@ -5793,119 +2861,106 @@ void DrawGfxPrioMaskTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nSt
 Zoomed Tile Functions
 ================================================================================================*/
 
-void RenderZoomedTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedTile called without init\n"));
-#endif
+#define RZ_PRIO			(1 << 0)		// drawn pixels set pPrioDraw to priority
+#define RZ_PRIOMASK		(1 << 1)		// pixels are hidden where bit pPrioDraw of priority is set, pPrioDraw is set to 0x1f
+#define RZ_TRANSTAB		(1 << 2)		// pixels with a tab[] entry of t aren't drawn, rather than pixels of t
 
+template <INT32 nMode>
+static inline void RenderZoomed(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT8 *tab, UINT32 color_offset, INT32 priority)
+{
 	// Based on MAME sources for tile zooming
 	UINT8 *gfx_base = gfx + (code * width * height);
 	int dh = (zoomy * height + 0x8000) / 0x10000;
 	int dw = (zoomx * width + 0x8000) / 0x10000;
 
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
-
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
+	if (dw == 0 || dh == 0) {
+		return;
+	}
 
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
+	int dx = (width * 0x10000) / dw;
+	int dy = (height * 0x10000) / dh;
+	int x_index_base = 0;
+	int y_index = 0;
 
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16];
+	if (fx) {
+		x_index_base = (dw - 1) * dx;
+		dx = -dx;
+	}
 
-						if (pxl != t)
-							dst[x] = pxl + color;
-					}
+	if (fy) {
+		y_index = (dh - 1) * dy;
+		dy = -dy;
+	}
 
-					x_index += dx;
-				}
-			}
+	// clip once for the whole tile, rather than for every pixel
+	INT32 x_start = (sx < nScreenWidthMin) ? nScreenWidthMin : sx;
+	INT32 x_end = (sx + dw > nScreenWidthMax) ? nScreenWidthMax : (sx + dw);
+	INT32 y_start = (sy < nScreenHeightMin) ? nScreenHeightMin : sy;
+	INT32 y_end = (sy + dh > nScreenHeightMax) ? nScreenHeightMax : (sy + dh);
 
-			y_index += dy;
-		}
+	if (x_start >= x_end || y_start >= y_end) {
+		return;
 	}
-}
 
-void RenderZoomedPrioTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, INT32 priority)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioTile called without init\n"));
-#endif
+	x_index_base += (x_start - sx) * dx;
+	y_index += (y_start - sy) * dy;
 
-	// Based on MAME sources for tile zooming
-	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
+	UINT32 nAdd = (nMode & RZ_TRANSTAB) ? color_offset : color;
 
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
+	if (nMode & RZ_PRIOMASK) {
+		priority |= 1 << 31;
+	}
 
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
+	for (INT32 y = y_start; y < y_end; y++, y_index += dy)
+	{
+		UINT8 *src = gfx_base + (y_index / 0x10000) * width;
+		UINT16 *dst = dest + y * nScreenWidth;
+		UINT8 *pri = pPrioDraw + y * nScreenWidth;
 
-		for (INT32 y = sy; y < ey; y++)
+		for (INT32 x = x_start, x_index = x_index_base; x < x_end; x++, x_index += dx)
 		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
-			UINT8 *pri = pPrioDraw + y * nScreenWidth;
+			INT32 pxl = src[x_index >> 16];
 
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16];
-
-						if (pxl != t) {
-							dst[x] = pxl + color;
-							pri[x] = priority;
-						}
-					}
+			if (nMode & RZ_TRANSTAB) {
+				pxl += color;
+				if (tab[pxl] == t) continue;
+			} else {
+				if (pxl == t) continue;
+			}
 
-					x_index += dx;
+			if (nMode & RZ_PRIOMASK) {
+				if ((priority & (1 << pri[x])) == 0) {
+					dst[x] = pxl + nAdd;
+				}
+				pri[x] = 0x1f;
+			} else {
+				dst[x] = pxl + nAdd;
+				if (nMode & RZ_PRIO) {
+					pri[x] = priority;
 				}
 			}
-
-			y_index += dy;
 		}
 	}
 }
 
+void RenderZoomedTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedTile called without init\n"));
+#endif
+
+	RenderZoomed<0>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, NULL, 0, 0);
+}
+
+void RenderZoomedPrioTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, INT32 priority)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioTile called without init\n"));
+#endif
+
+	RenderZoomed<RZ_PRIO>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, NULL, 0, priority);
+}
+
 /*================================================================================================
 Tile with Transparency Table Functions
 ================================================================================================*/
@@ -6028,60 +3083,7 @@ void RenderZoomedPrioSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, I
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioSprite called without init\n"));
 #endif
 
-	// Based on MAME sources for tile zooming
-	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
-
-	priority |= 1 << 31;
-
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
-
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
-
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
-			UINT8 *pri = pPrioDraw + y * nScreenWidth;
-
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16];
-
-						if (pxl != t) {
-							if ((priority & (1 << pri[x])) == 0) {
-								dst[x] = pxl + color;
-							}
-							pri[x] = 0x1f;
-						}
-					}
-
-					x_index += dx;
-				}
-			}
-
-			y_index += dy;
-		}
-	}
+	RenderZoomed<RZ_PRIOMASK>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, NULL, 0, priority);
 }
 
 
@@ -6132,60 +3134,7 @@ void RenderZoomedPrioTranstabSpriteOffset(UINT16 *dest, UINT8 *gfx, INT32 code,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioSprite called without init\n"));
 #endif
 
-	// Based on MAME sources for tile zooming
-	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
-
-	priority |= 1 << 31;
-
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
-
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
-
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
-			UINT8 *pri = pPrioDraw + y * nScreenWidth;
-
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16] + color;
-
-						if (tab[pxl] != t) {
-							if ((priority & (1 << pri[x])) == 0) {
-								dst[x] = pxl + color_offset;
-							}
-							pri[x] = 0x1f;
-						}
-					}
-
-					x_index += dx;
-				}
-			}
-
-			y_index += dy;
-		}
-	}
+	RenderZoomed<RZ_PRIOMASK | RZ_TRANSTAB>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, tab, color_offset, priority);
 }
 
 void RenderZoomedPrioTranstabSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT8 *tab, INT32 priority)
@@ -6193,3 +3142,6 @@ void RenderZoomedPrioTranstabSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32
 	RenderZoomedPrioTranstabSpriteOffset(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, tab, 0x00, priority);
 }
 
+#undef RZ_PRIO
+#undef RZ_PRIOMASK
+#undef RZ_TRANSTAB
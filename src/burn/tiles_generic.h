@@ -20,7 +20,7 @@ void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWid
 
 extern UINT8* pTileData;
 extern INT32 nScreenWidth, nScreenHeight;
-extern UINT8 GenericTilesPRIMASK;
+extern BURN_THREAD_LOCAL UINT8 GenericTilesPRIMASK;
 
 INT32 GenericTilesInit();
 INT32 GenericTilesExit();
@@ -45,6 +45,15 @@ void GenericTilesSetClipRaw(INT32 nMinx, INT32 nMaxx, INT32 nMiny, INT32 nMaxy);
 void GenericTilesClearClipRaw();
 void GenericTilesSetScanline(INT32 nScanline);
 
+// Call pDraw once for each of a few horizontal bands of the screen, spread over the worker threads.
+// Each call sees the clip narrowed to its band (Set/ClearClip stay inside it), so pDraw must only
+// draw to pTransDraw/pPrioDraw through the clipped renderers and GenericTilemapDraw(), and not
+// touch anything shared besides that (no dirty tiles, BurnBitmaps or SetClipRaw).  Tilemap caches
+// aren't used while drawing a band.  Falls back to a single call when there's one thread.
+void GenericTilesDrawBands(void (*pDraw)());
+// The clip as it would be if it wasn't narrowed to the band, returns 1 when drawing a band
+INT32 GenericTilesGetUnbandedClip(INT32 *nMinx, INT32 *nMaxx, INT32 *nMiny, INT32 *nMaxy);
+
 // Sprite priority handling is different than tile!
 void RenderPrioSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 priority);
 void RenderZoomedPrioSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, INT32 priority);
@@ -256,3 +265,17 @@ void BurnPrioClear();
 INT32 BurnTransferCopy(UINT32* pPalette);
 void BurnTransferExit();
 INT32 BurnTransferInit();
+
+// ---------------------------------------------------------------------------
+// Pipelined drawing, frame N is drawn on a thread of its own while frame N+1 is emulated
+//
+// pSnapshot (run on the emulation thread) copies everything the driver draws from (video ram,
+// registers, the palette) to buffers only pRender reads.  pRender draws the copies to pTransDraw,
+// without BurnTransferCopy(), which is done with pPalette once the frame is finished.  Call
+// BurnVideoPipelineFrame() from the Frame function where the driver would draw, and use
+// BurnVideoPipelineDraw() as the driver's Redraw function.  With bBurnVideoPipeline set, each
+// frame shows the one before it, so the image is a frame late.
+void BurnVideoPipelineInit(void (*pSnapshot)(), void (*pRender)(), UINT32* pPalette);
+void BurnVideoPipelineExit();
+INT32 BurnVideoPipelineFrame();
+INT32 BurnVideoPipelineDraw();
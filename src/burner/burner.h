@@ -199,6 +199,19 @@ INT32 BurnStateUNDO(TCHAR* szName);
 // statec.cpp
 INT32 BurnStateCompress(UINT8** pDef, INT32* pnDefLen, INT32 bAll);
 INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll);
+INT32 BurnStateSaveRaw(UINT8** pState, INT32* pnLen);
+INT32 BurnStateLoadRaw(const UINT8* pState, INT32 nLen);
+INT32 BurnStateRawExit();
+
+// rewind.cpp
+INT32 RewindInit(INT32 nBufferSize, INT32 nInterval);
+INT32 RewindExit();
+INT32 RewindReset();
+INT32 RewindFrame();
+INT32 RewindStep();
+
+// runahead.cpp
+INT32 RunAheadFrame(INT32 nRunAhead, INT32 bDraw);
 
 // zipfn.cpp
 struct ZipEntry { char* szName;	UINT32 nLen; UINT32 nCrc; };
@@ -208,6 +221,9 @@ INT32 ZipClose();
 INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount);
 INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
 INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
+void* ZipHandleOpen(char* szZip);
+INT32 ZipHandleClose(void* pHandle);
+INT32 ZipHandleLoadFile(void* pHandle, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
 
 // bzip.cpp
 
@@ -38,19 +38,14 @@ int MainInit(const char *path, const char *setname)
     snprintf(message, sizeof(message), "Initializing '%s' in '%s'...\n", setname, path);
     ProgressUpdateBurner(0, message, false);
 
-    int i;
-    for (i = 0; i < nBurnDrvCount; i++) {
-        nBurnDrvActive = i;
-        if (strcmp(BurnDrvGetTextA(0), setname) == 0) {
-            break;
-        }
-    }
+    int i = BurnDrvFind(setname);
 
-    if (i == nBurnDrvCount) {
+    if (i < 0) {
         snprintf(message, sizeof(message), "'%s' is not supported by FB Neo.", setname);
         AppError(message, false);
         return 1;
     }
+    nBurnDrvActive = i;
 
     bCheatsAllowed = false;
     sprintf(szAppRomPaths[0], path);
@@ -176,19 +176,13 @@ int main(int argc, char *argv[])
 	SDL_Init(SDL_INIT_TIMER|SDL_INIT_VIDEO);
 	BurnLibInit();
 
-	int driverId = -1;
-	for (int i = 0; i < (int) nBurnDrvCount; i++) {
-		nBurnDrvActive = i;
-		if (strcmp(BurnDrvGetTextA(0), romname) == 0) {
-			driverId = i;
-			break;
-		}
-	}
+	int driverId = BurnDrvFind(romname);
 
 	if (driverId < 0) {
 		fprintf(stderr, "%s is not supported by FB Alpha\n", romname);
 		return 1;
 	}
+	nBurnDrvActive = driverId;
 
 	printf("Starting %s\n", romname);
 
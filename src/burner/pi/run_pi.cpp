@@ -5,6 +5,15 @@ bool bAltPause = 0;
 
 int bAlwaysDrawFrames = 0;
 
+bool bRunProfileZones = false;				// Time the profiling zones and write them to PROFILE_ZONES_CSV
+
+bool bRunRewind = false;					// Keep a rewind history
+int nRunRewindSize = 64;					// Rewind history size in MB
+int nRunRewindInterval = 2;					// Rewind snapshot every n frames
+bool bRunRewinding = false;					// Rewind key held
+
+int nRunAhead = 0;							// Frames to run ahead
+
 static bool bShowFPS = false;
 
 int counter;								// General purpose variable used when debugging
@@ -51,9 +60,21 @@ static int RunFrame(int bDraw, int bPause)
 		nFramesEmulated++;
 		nCurrentFrame++;
 		InputMake(true);
+		if (bRunRewinding) {
+			RewindStep();					// Go back to the previous snapshot before running the frame
+		} else {
+			RewindFrame();					// Take a snapshot of the state the frame starts from
+		}
 	}
 
-	if (bDraw) {
+	if (nRunAhead > 0 && !bPause && !bRunRewinding) {
+		if (bDraw) {
+			nFramesRendered++;
+		}
+		if (RunAheadFrame(nRunAhead, bDraw)) {
+			AudBlankSound();
+		}
+	} else if (bDraw) {
 		nFramesRendered++;
 		if (VidFrame()) {
 			AudBlankSound();
@@ -63,6 +84,10 @@ static int RunFrame(int bDraw, int bPause)
 		BurnDrvFrame();
 	}
 
+	if (!bPause) {
+		ProfileZonesFrame();
+	}
+
 	bPrevPause = bPause;
 	bPrevDraw = bDraw;
 
@@ -174,6 +199,14 @@ static int RunInit()
 
 	ReadNVRAM();
 
+	if (bRunProfileZones) {
+		ProfileZonesInit(PROFILE_ZONES_CSV);
+	}
+
+	if (bRunRewind) {
+		RewindInit(nRunRewindSize << 20, nRunRewindInterval);
+	}
+
 	return 0;
 }
 
@@ -182,6 +215,9 @@ static int RunExit()
 	nNormalLast = 0;
 	SaveNVRAM();
 
+	ProfileZonesExit();
+	RewindExit();
+
 	return 0;
 }
 
@@ -229,7 +265,9 @@ int ReadNVRAM()
 	snprintf(temp, 255, "nvram/%s.nvr", BurnDrvGetTextA(0));
 
 	fprintf(stderr, "Reading NVRAM from \"%s\"\n", temp);
-    BurnStateLoad(temp, 0, NULL);
+    if (BurnStateLoad(temp, 0, NULL) == 0) {
+		RewindReset();						// Don't rewind into the game from before the load
+	}
 
     return 0;
 }
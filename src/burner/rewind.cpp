@@ -0,0 +1,342 @@
+// Rewind module
+//
+// Keeps a ring of recent savestates in memory.  The newest snapshot is held in full, and each
+// older one is stored as the XOR difference to the snapshot after it, run-length encoded so the
+// unchanged bytes (nearly all of them, frame to frame) cost nothing.  Stepping back applies the
+// newest difference to the full snapshot, which gives the one before it.  When the buffer is
+// full the oldest differences are dropped.
+#include "burner.h"
+
+#define REWIND_MAX_ENTRIES		(8192)
+#define REWIND_MAX_RUN			(0xffff)
+#define REWIND_MIN_SKIP			(4)				// unchanged bytes needed to end a literal run
+
+// Worst case size of an encoded difference of nLen bytes
+#define REWIND_MAX_ENCODED(nLen)	((nLen) + ((nLen) / REWIND_MAX_RUN + 1) * 8)
+
+struct RewindEntry { INT32 nOffset; INT32 nLen; };
+
+static struct RewindEntry RewindEntries[REWIND_MAX_ENTRIES];
+static INT32 nRewindFirst = 0;					// oldest entry
+static INT32 nRewindCount = 0;
+
+static UINT8* pRewindBuffer = NULL;				// encoded differences
+static INT32 nRewindBufferLen = 0;
+static INT32 nRewindBufferPos = 0;				// end of the newest entry
+
+static UINT8* pRewindCurrent = NULL;			// newest snapshot
+static UINT8* pRewindCapture = NULL;			// snapshot being taken
+static INT32 nRewindStateLen = 0;
+static INT32 nRewindStatePos = 0;
+static bool bRewindCurrentValid = false;
+static bool bRewindOverflow = false;
+static bool bRewindLoaded = false;				// the newest snapshot is what the driver was last stepped back to
+
+static INT32 nRewindInterval = 1;
+static INT32 nRewindFrame = 0;
+
+static UINT8* pRewindResetInput = NULL;			// the driver's reset input
+
+// -----------------------------------------------------------------------------
+// Difference coding
+//
+// A list of (skip, copy) pairs, each a little-endian 16-bit count, with the copy bytes after
+// them.  Skipped bytes are unchanged, copied bytes are the XOR of the two snapshots.
+
+static inline UINT64 RewindLoad64(const UINT8* p)
+{
+	UINT64 n;
+	memcpy(&n, p, sizeof(n));
+
+	return n;
+}
+
+static INT32 RewindEncode(const UINT8* pOld, const UINT8* pNew, INT32 nLen, UINT8* pDest)
+{
+	UINT8* pOut = pDest;
+	INT32 i = 0;
+
+	while (i < nLen) {
+		INT32 nSkipStart = i;
+
+		while (i + 8 <= nLen && (i + 8) - nSkipStart <= REWIND_MAX_RUN && RewindLoad64(pOld + i) == RewindLoad64(pNew + i)) {
+			i += 8;
+		}
+		while (i < nLen && i - nSkipStart < REWIND_MAX_RUN && pOld[i] == pNew[i]) {
+			i++;
+		}
+
+		INT32 nSkip = i - nSkipStart;
+		INT32 nCopyStart = i;
+		INT32 nEqual = 0;
+
+		while (i < nLen && i - nCopyStart < REWIND_MAX_RUN) {
+			if (pOld[i] == pNew[i]) {
+				nEqual++;
+			} else {
+				nEqual = 0;
+			}
+			i++;
+
+			if (nEqual == REWIND_MIN_SKIP) {
+				i -= REWIND_MIN_SKIP;
+				break;
+			}
+		}
+
+		INT32 nCopy = i - nCopyStart;
+
+		pOut[0] = nSkip & 0xff;
+		pOut[1] = nSkip >> 8;
+		pOut[2] = nCopy & 0xff;
+		pOut[3] = nCopy >> 8;
+		pOut += 4;
+
+		for (INT32 j = nCopyStart; j < i; j++) {
+			*pOut++ = pOld[j] ^ pNew[j];
+		}
+	}
+
+	return pOut - pDest;
+}
+
+static void RewindDecode(const UINT8* pSrc, UINT8* pDest, INT32 nLen)
+{
+	INT32 i = 0;
+
+	while (i < nLen) {
+		INT32 nSkip = pSrc[0] | (pSrc[1] << 8);
+		INT32 nCopy = pSrc[2] | (pSrc[3] << 8);
+		pSrc += 4;
+
+		i += nSkip;
+		for (INT32 j = 0; j < nCopy; j++) {
+			pDest[i++] ^= *pSrc++;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+// Savestate callbacks
+
+static INT32 __cdecl RewindLenAcb(struct BurnArea* pba)
+{
+	nRewindStateLen += pba->nLen;
+
+	return 0;
+}
+
+static INT32 __cdecl RewindCaptureAcb(struct BurnArea* pba)
+{
+	if (nRewindStatePos + (INT32)pba->nLen > nRewindStateLen) {
+		bRewindOverflow = true;
+		return 0;
+	}
+
+	memcpy(pRewindCapture + nRewindStatePos, pba->Data, pba->nLen);
+	nRewindStatePos += pba->nLen;
+
+	return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Ring of differences
+
+static void RewindDropOldest()
+{
+	nRewindFirst = (nRewindFirst + 1) % REWIND_MAX_ENTRIES;
+	nRewindCount--;
+}
+
+// Make room for an entry of up to nLen bytes, and return where to put it
+static INT32 RewindAlloc(INT32 nLen)
+{
+	INT32 nPos = nRewindBufferPos;
+
+	if (nRewindCount == REWIND_MAX_ENTRIES) {
+		RewindDropOldest();
+	}
+
+	if (nPos + nLen > nRewindBufferLen) {
+		// Wrap around, the entries past the newest one are the oldest ones, and would otherwise be out of order
+		while (nRewindCount && RewindEntries[nRewindFirst].nOffset >= nPos) {
+			RewindDropOldest();
+		}
+		nPos = 0;
+	}
+
+	// Drop the oldest entries until they don't overlap the space we need
+	while (nRewindCount) {
+		struct RewindEntry* pre = &RewindEntries[nRewindFirst];
+
+		if (pre->nOffset >= nPos + nLen || pre->nOffset + pre->nLen <= nPos) {
+			break;
+		}
+
+		RewindDropOldest();
+	}
+
+	return nPos;
+}
+
+// -----------------------------------------------------------------------------
+
+// Take a snapshot, and push the difference to the previous one
+static INT32 RewindCapture()
+{
+	nRewindStatePos = 0;
+	bRewindOverflow = false;
+
+	BurnAcb = RewindCaptureAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	if (bRewindOverflow || nRewindStatePos != nRewindStateLen) {
+		// The driver's state changed size, the history can't be used any more
+		RewindReset();
+		return 1;
+	}
+
+	if (bRewindCurrentValid) {
+		INT32 nPos = RewindAlloc(REWIND_MAX_ENCODED(nRewindStateLen));
+		INT32 nLen = RewindEncode(pRewindCurrent, pRewindCapture, nRewindStateLen, pRewindBuffer + nPos);
+
+		struct RewindEntry* pre = &RewindEntries[(nRewindFirst + nRewindCount) % REWIND_MAX_ENTRIES];
+		pre->nOffset = nPos;
+		pre->nLen = nLen;
+		nRewindCount++;
+
+		nRewindBufferPos = nPos + nLen;
+	}
+
+	UINT8* pTemp = pRewindCurrent;
+	pRewindCurrent = pRewindCapture;
+	pRewindCapture = pTemp;
+
+	bRewindCurrentValid = true;
+
+	return 0;
+}
+
+// Call once per emulated frame, before running it
+INT32 RewindFrame()
+{
+	if (pRewindBuffer == NULL) {
+		return 1;
+	}
+
+	if (pRewindResetInput && *pRewindResetInput) {
+		// The driver is being reset, don't step back into the game from before it
+		RewindReset();
+		return 0;
+	}
+
+	bRewindLoaded = false;
+
+	if (++nRewindFrame < nRewindInterval) {
+		return 0;
+	}
+	nRewindFrame = 0;
+
+	return RewindCapture();
+}
+
+// Load the newest snapshot into the driver, or if that's where the last call left it, step the
+// history back one first (the oldest one stays loaded once there are no more).  Call instead of
+// RewindFrame(), before running the frame.
+INT32 RewindStep()
+{
+	if (pRewindBuffer == NULL || !bRewindCurrentValid) {
+		return 1;
+	}
+
+	if (bRewindLoaded && nRewindCount) {
+		struct RewindEntry* pre = &RewindEntries[(nRewindFirst + nRewindCount - 1) % REWIND_MAX_ENTRIES];
+
+		RewindDecode(pRewindBuffer + pre->nOffset, pRewindCurrent, nRewindStateLen);
+
+		nRewindCount--;
+		nRewindBufferPos = pre->nOffset;
+	}
+
+	// The loaded snapshot stays the newest one, so the next capture is a whole interval after it
+	BurnStateLoadRaw(pRewindCurrent, nRewindStateLen);
+
+	bRewindLoaded = true;
+	nRewindFrame = 0;
+
+	return 0;
+}
+
+// Forget the history, call after loading a state or resetting the driver
+INT32 RewindReset()
+{
+	nRewindFirst = 0;
+	nRewindCount = 0;
+	nRewindBufferPos = 0;
+	nRewindFrame = 0;
+
+	bRewindCurrentValid = false;
+	bRewindLoaded = false;
+
+	return 0;
+}
+
+INT32 RewindExit()
+{
+	free(pRewindBuffer);
+	pRewindBuffer = NULL;
+	free(pRewindCurrent);
+	pRewindCurrent = NULL;
+	free(pRewindCapture);
+	pRewindCapture = NULL;
+
+	nRewindBufferLen = 0;
+	nRewindStateLen = 0;
+
+	pRewindResetInput = NULL;
+
+	RewindReset();
+
+	return 0;
+}
+
+// nBufferSize is the memory to use for the history in bytes, a snapshot is taken every nInterval frames
+INT32 RewindInit(INT32 nBufferSize, INT32 nInterval)
+{
+	RewindExit();
+
+	if (!bDrvOkay) {
+		return 1;
+	}
+
+	nRewindStateLen = 0;
+	BurnAcb = RewindLenAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	// The buffer needs to hold at least a couple of worst case differences
+	if (nRewindStateLen <= 0 || nBufferSize < REWIND_MAX_ENCODED(nRewindStateLen) * 2) {
+		nRewindStateLen = 0;
+		return 1;
+	}
+
+	pRewindCurrent = (UINT8*)malloc(nRewindStateLen);
+	pRewindCapture = (UINT8*)malloc(nRewindStateLen);
+	pRewindBuffer = (UINT8*)malloc(nBufferSize);
+	if (pRewindCurrent == NULL || pRewindCapture == NULL || pRewindBuffer == NULL) {
+		RewindExit();
+		return 1;
+	}
+
+	nRewindBufferLen = nBufferSize;
+	nRewindInterval = (nInterval > 0) ? nInterval : 1;
+
+	struct BurnInputInfo bii;
+	for (UINT32 i = 0; BurnDrvGetInputInfo(&bii, i) == 0; i++) {
+		if (bii.szInfo && strcmp(bii.szInfo, "reset") == 0 && (bii.nType & BIT_DIGITAL)) {
+			pRewindResetInput = bii.pVal;
+			break;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,39 @@
+// Run-ahead module
+//
+// Hides the input lag built into a game by running it a few frames into the future every frame.
+// The real frame is run with sound but without an image, the state is kept in memory, then
+// nRunAhead frames are run with the latest inputs and only the last of them is shown, and
+// finally the state is put back so the next frame carries on from the real one.
+#include "burner.h"
+
+// Run one frame nRunAhead frames ahead, only draws the image if bDraw is set
+INT32 RunAheadFrame(INT32 nRunAhead, INT32 bDraw)
+{
+	INT16* pSoundOut = pBurnSoundOut;
+
+	// The real frame, with sound
+	pBurnDraw = NULL;
+	BurnDrvFrame();
+
+	if (!bDraw || nRunAhead <= 0) {
+		return 0;
+	}
+
+	if (BurnStateSaveRaw(NULL, NULL)) {
+		return 1;
+	}
+
+	// The frames ahead, without sound, and only the last one drawn
+	pBurnSoundOut = NULL;
+	for (INT32 i = 1; i < nRunAhead; i++) {
+		pBurnDraw = NULL;
+		BurnDrvFrame();
+	}
+	INT32 nRet = VidFrame();
+
+	BurnStateLoadRaw(NULL, 0);
+
+	pBurnSoundOut = pSoundOut;
+
+	return nRet;
+}
@@ -0,0 +1,265 @@
+// Headless benchmark module
+//
+// Loads a driver by zip name and runs it for a fixed number of frames with no window and
+// no audio device, so the numbers reflect emulation cost only (no vsync or audio blocking).
+//
+// usage: fbneo-bench <romname> [frames] [warmup frames] [profile zones csv]
+
+#include "burner.h"
+
+#include <time.h>
+
+#define BENCH_DEFAULT_FRAMES	(3000)
+#define BENCH_DEFAULT_WARMUP	(120)
+#define BENCH_SOUND_RATE		(44100)
+
+// Globals normally provided by main.cpp
+int nAppVirtualFps = 6000;			// App fps * 100
+bool bRunPause = 0;
+bool bAlwaysProcessKeyboardInput = 0;
+
+static UINT8* pBenchDraw = NULL;
+static INT16* pBenchSound = NULL;
+
+static UINT64 nBenchHash;
+
+static UINT64 BenchGetTicks()		// monotonic time in nanoseconds
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (UINT64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static UINT32 __cdecl BenchHighCol(INT32 r, INT32 g, INT32 b, INT32 /* i */)
+{
+	return (r << 16) | (g << 8) | b;
+}
+
+// FNV-1a over every area the driver would put in a savestate
+static INT32 __cdecl BenchHashAcb(struct BurnArea* pba)
+{
+	UINT8* pData = (UINT8*)pba->Data;
+
+	for (UINT32 i = 0; i < pba->nLen; i++) {
+		nBenchHash ^= pData[i];
+		nBenchHash *= 0x100000001b3ULL;
+	}
+
+	return 0;
+}
+
+static UINT64 BenchStateHash()
+{
+	nBenchHash = 0xcbf29ce484222325ULL;
+
+	BurnAcb = BenchHashAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	return nBenchHash;
+}
+
+static int BenchCompareTimes(const void* a, const void* b)
+{
+	UINT64 ta = *(const UINT64*)a;
+	UINT64 tb = *(const UINT64*)b;
+
+	return (ta > tb) - (ta < tb);
+}
+
+static int BenchDrvInit(UINT32 nDrvNum)
+{
+	INT32 nWidth, nHeight;
+
+	nBurnDrvSelect[0] = nDrvNum;
+	nBurnDrvActive = nDrvNum;
+
+	// Set up the dip switches with the driver defaults, no input plugin is needed for this
+	nMaxPlayers = BurnDrvGetMaxPlayers();
+	GameInpInit();
+	InpDIPSWResetDIPs();
+
+	struct GameInp* pgi = GameInp;
+	for (UINT32 i = 0; i < nGameInpCount; i++, pgi++) {
+		if (pgi->nInput == GIT_CONSTANT && pgi->Input.pVal) {
+			*(pgi->Input.pVal) = pgi->Input.Constant.nConst;
+		}
+	}
+
+	nBurnBpp = 4;
+	BurnHighCol = BenchHighCol;
+
+	nBurnSoundRate = BENCH_SOUND_RATE;
+	pBurnSoundOut = NULL;
+
+	BzipOpen(false);
+	INT32 nRet = BurnDrvInit();
+	BzipClose();
+
+	if (nRet) {
+		BurnDrvExit();
+		GameInpExit();
+		return 1;
+	}
+
+	// Off-screen buffers, sized once the driver has set up its screen and refresh rate
+	BurnDrvGetFullSize(&nWidth, &nHeight);
+	nBurnPitch = nWidth * nBurnBpp;
+	pBenchDraw = (UINT8*)malloc(nBurnPitch * nHeight);
+	pBenchSound = (INT16*)malloc(nBurnSoundLen * 2 * sizeof(INT16) * 2);
+	if (pBenchDraw == NULL || pBenchSound == NULL) {
+		BurnDrvExit();
+		GameInpExit();
+		return 1;
+	}
+	memset(pBenchDraw, 0, nBurnPitch * nHeight);
+
+	bDrvOkay = 1;
+
+	return 0;
+}
+
+static void BenchDrvExit()
+{
+	if (bDrvOkay) {
+		BurnDrvExit();
+		GameInpExit();
+	}
+	bDrvOkay = 0;
+
+	pBurnDraw = NULL;
+	pBurnSoundOut = NULL;
+
+	free(pBenchDraw);
+	pBenchDraw = NULL;
+	free(pBenchSound);
+	pBenchSound = NULL;
+}
+
+static void BenchFrame()
+{
+	pBurnDraw = pBenchDraw;
+	pBurnSoundOut = pBenchSound;
+
+	nFramesEmulated++;
+	nFramesRendered++;
+	nCurrentFrame++;
+
+	BurnDrvFrame();
+}
+
+#undef main
+
+int main(int argc, char *argv[])
+{
+	INT32 nFrames = BENCH_DEFAULT_FRAMES;
+	INT32 nWarmup = BENCH_DEFAULT_WARMUP;
+
+	if (argc < 2) {
+		printf("Usage: %1$s <romname> [frames] [warmup frames] [profile zones csv]\n   ie: %1$s uopoko 3000 120\n Note: no extension.\n\n", argv[0]);
+		return 0;
+	}
+
+	if (argc > 2) {
+		nFrames = atoi(argv[2]);
+	}
+	if (argc > 3) {
+		nWarmup = atoi(argv[3]);
+	}
+	if (nFrames <= 0 || nWarmup < 0) {
+		printf("Invalid frame count.\n");
+		return 1;
+	}
+
+	ConfigAppLoad();							// rom paths
+	BurnLibInit();
+
+	INT32 nDrv = BurnDrvFind(argv[1]);
+
+	if (nDrv < 0) {
+		printf("%s is not supported by FinalBurn Neo.\n", argv[1]);
+		return 1;
+	}
+
+	if (BenchDrvInit(nDrv)) {
+		printf("There was an error loading %s.\n", argv[1]);
+		BenchDrvExit();
+		BurnLibExit();
+		return 1;
+	}
+
+	for (INT32 f = 0; f < nWarmup; f++) {
+		BenchFrame();
+	}
+
+	UINT64* pTimes = (UINT64*)malloc(nFrames * sizeof(UINT64));
+	if (pTimes == NULL) {
+		BenchDrvExit();
+		BurnLibExit();
+		return 1;
+	}
+
+	if (argc > 4) {
+		ProfileZonesInit(argv[4]);
+	}
+
+	// Only the frames are timed, not the profile zone bookkeeping between them
+	UINT64 nTotal = 0;
+	for (INT32 f = 0; f < nFrames; f++) {
+		UINT64 nFrameStart = BenchGetTicks();
+		BenchFrame();
+		pTimes[f] = BenchGetTicks() - nFrameStart;
+		nTotal += pTimes[f];
+		ProfileZonesFrame();
+	}
+
+	UINT64 nHash = BenchStateHash();
+
+	qsort(pTimes, nFrames, sizeof(UINT64), BenchCompareTimes);
+
+	INT32 nP99 = (nFrames * 99) / 100;
+	if (nP99 >= nFrames) {
+		nP99 = nFrames - 1;
+	}
+
+	printf("driver:     %s (%s)\n", BurnDrvGetTextA(DRV_NAME), BurnDrvGetTextA(DRV_FULLNAME));
+	printf("frames:     %d (+%d warmup)\n", nFrames, nWarmup);
+	printf("fps:        %.2f (native %.2f)\n", (double)nFrames * 1000000000.0 / nTotal, (double)nBurnFPS / 100.0);
+	printf("frame ms:   min %.3f avg %.3f p99 %.3f max %.3f\n",
+		pTimes[0] / 1000000.0, (double)nTotal / nFrames / 1000000.0, pTimes[nP99] / 1000000.0, pTimes[nFrames - 1] / 1000000.0);
+	printf("state hash: %016llx\n", (unsigned long long)nHash);
+
+	free(pTimes);
+
+	ProfileZonesExit();
+
+	BenchDrvExit();
+	BurnLibExit();
+
+	return 0;
+}
+
+/* const */ TCHAR* ANSIToTCHAR(const char* pszInString, TCHAR* pszOutString, int nOutSize)
+{
+	if (pszOutString) {
+		_tcscpy(pszOutString, pszInString);
+		return pszOutString;
+	}
+
+	return (TCHAR*)pszInString;
+}
+
+/* const */ char* TCHARToANSI(const TCHAR* pszInString, char* pszOutString, int nOutSize)
+{
+	if (pszOutString) {
+		strcpy(pszOutString, pszInString);
+		return pszOutString;
+	}
+
+	return (char*)pszInString;
+}
+
+bool AppProcessKeyboardInput()
+{
+	return true;
+}
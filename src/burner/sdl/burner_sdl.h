@@ -42,7 +42,18 @@ int DrvExit();
 int ProgressUpdateBurner(double dProgress, const TCHAR* pszText, bool bAbs);
 int AppError(TCHAR* szText, int bWarning);
 
+//bzip.cpp
+extern bool bBzipPrepared;
+extern char szAppPreparedPath[MAX_PATH];
+
 //run.cpp
+#define PROFILE_ZONES_CSV "fbneo_profile.csv"
+extern bool bRunProfileZones;
+extern bool bRunRewind;
+extern int nRunRewindSize;
+extern int nRunRewindInterval;
+extern bool bRunRewinding;
+extern int nRunAhead;
 extern int RunMessageLoop();
 extern int RunReset();
 
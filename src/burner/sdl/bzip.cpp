@@ -1,6 +1,10 @@
 // Burner Zip module
 #include "burner.h"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 int nBzipError = 0;												// non-zero if there is a problem with the opened romset
 
 static TCHAR* szBzipName[BZIP_MAX] = { NULL, };					// Zip files to search through
@@ -236,6 +240,481 @@ static int CheckRoms()
 	return 0;
 }
 
+// -----------------------------------------------------------------------------
+// Rom prefetching
+//
+// Drivers load their roms one at a time, so once the zips have been scanned a few worker threads
+// start inflating every rom the driver is going to need into memory, in rom order.  When the
+// driver asks for a rom that's ready it's just copied, and if it hasn't been started yet the
+// driver's thread loads it itself.  Roms in .7z files are left to the normal path.
+
+#define BZIP_PREFETCH_THREADS	(8)
+#define BZIP_PREFETCH_BUDGET	(256 << 20)					// Most memory to hold in roms nobody has asked for yet
+
+struct RomPrefetch { int nState; int nLen; int nWrote; int nRet; unsigned char* pData; };
+
+enum { PREFETCH_NONE = 0, PREFETCH_QUEUED, PREFETCH_LOADING, PREFETCH_DONE, PREFETCH_USED };
+
+static struct RomPrefetch* RomPrefetch = NULL;
+static std::thread* PrefetchThread[BZIP_PREFETCH_THREADS];
+static int nPrefetchThreads = 0;
+static int nPrefetchNext = 0;									// Next rom to look at
+static int nPrefetchPending = 0;								// Memory held in roms which haven't been used yet
+static bool bPrefetchExit = false;
+static std::mutex PrefetchMutex;
+static std::condition_variable PrefetchCond;
+
+static void PrefetchWorker()
+{
+	void* pZip = NULL;
+	int nZip = -1;
+
+	std::unique_lock<std::mutex> lock(PrefetchMutex);
+
+	while (!bPrefetchExit) {
+		while (nPrefetchNext < nRomCount && RomPrefetch[nPrefetchNext].nState != PREFETCH_QUEUED) {
+			nPrefetchNext++;
+		}
+		if (nPrefetchNext >= nRomCount) {
+			break;
+		}
+
+		int i = nPrefetchNext;
+		struct RomPrefetch* prp = &RomPrefetch[i];
+
+		if (nPrefetchPending && nPrefetchPending + prp->nLen > BZIP_PREFETCH_BUDGET) {
+			PrefetchCond.wait(lock);								// Wait for the driver to use some of the roms
+			continue;
+		}
+
+		prp->nState = PREFETCH_LOADING;
+		nPrefetchPending += prp->nLen;
+		nPrefetchNext++;
+
+		lock.unlock();
+
+		if (nZip != RomFind[i].nZip) {
+			ZipHandleClose(pZip);
+			nZip = RomFind[i].nZip;
+			pZip = ZipHandleOpen(TCHARToANSI(szBzipName[nZip], NULL, 0));
+		}
+
+		prp->nWrote = 0;
+		prp->pData = NULL;
+		if (pZip == NULL) {
+			prp->nRet = -1;										// Not a .zip, see above
+		} else if ((prp->pData = (unsigned char*)malloc(prp->nLen)) == NULL) {
+			prp->nRet = -1;
+		} else {
+			prp->nRet = ZipHandleLoadFile(pZip, prp->pData, prp->nLen, &prp->nWrote, RomFind[i].nPos);
+		}
+
+		lock.lock();
+
+		prp->nState = PREFETCH_DONE;
+		PrefetchCond.notify_all();
+	}
+
+	lock.unlock();
+
+	ZipHandleClose(pZip);
+}
+
+static void PrefetchExit()
+{
+	{
+		std::lock_guard<std::mutex> lock(PrefetchMutex);
+		bPrefetchExit = true;
+	}
+	PrefetchCond.notify_all();
+
+	for (int t = 0; t < nPrefetchThreads; t++) {
+		PrefetchThread[t]->join();
+		delete PrefetchThread[t];
+		PrefetchThread[t] = NULL;
+	}
+	nPrefetchThreads = 0;
+
+	if (RomPrefetch) {
+		for (int i = 0; i < nRomCount; i++) {
+			free(RomPrefetch[i].pData);
+		}
+		free(RomPrefetch);
+		RomPrefetch = NULL;
+	}
+
+	nPrefetchPending = 0;
+	nPrefetchNext = 0;
+}
+
+static void PrefetchInit()
+{
+	int nThreads = std::thread::hardware_concurrency();
+
+	if (nThreads < 2) {
+		return;
+	}
+	if (nThreads > BZIP_PREFETCH_THREADS) {
+		nThreads = BZIP_PREFETCH_THREADS;
+	}
+
+	RomPrefetch = (struct RomPrefetch*)calloc(nRomCount, sizeof(struct RomPrefetch));
+	if (RomPrefetch == NULL) {
+		return;
+	}
+
+	int nQueued = 0;
+	for (int i = 0; i < nRomCount; i++) {
+		struct BurnRomInfo ri;
+
+		if (RomFind[i].nState == 0) {
+			continue;
+		}
+
+		memset(&ri, 0, sizeof(ri));
+		BurnDrvGetRomInfo(&ri, i);
+
+		if ((ri.nType & (BRF_OPT | BRF_NODUMP)) || ri.nLen <= 0) {	// Optional roms often aren't loaded at all
+			continue;
+		}
+
+		RomPrefetch[i].nState = PREFETCH_QUEUED;
+		RomPrefetch[i].nLen = ri.nLen;
+		nQueued++;
+	}
+
+	if (nQueued < 2) {
+		free(RomPrefetch);
+		RomPrefetch = NULL;
+		return;
+	}
+
+	bPrefetchExit = false;
+	nPrefetchNext = 0;
+	nPrefetchPending = 0;
+
+	for (nPrefetchThreads = 0; nPrefetchThreads < nThreads; nPrefetchThreads++) {
+		PrefetchThread[nPrefetchThreads] = new std::thread(PrefetchWorker);
+	}
+}
+
+// Get rom i from the prefetcher, returns -1 if it wasn't prefetched
+static int PrefetchLoadRom(unsigned char* Dest, int* pnWrote, int i, int nLen)
+{
+	if (RomPrefetch == NULL) {
+		return -1;
+	}
+
+	std::unique_lock<std::mutex> lock(PrefetchMutex);
+
+	struct RomPrefetch* prp = &RomPrefetch[i];
+
+	if (prp->nState == PREFETCH_NONE || prp->nState == PREFETCH_USED || prp->nLen != nLen) {
+		return -1;
+	}
+
+	if (prp->nState == PREFETCH_QUEUED) {
+		// Not started yet, load it ourselves
+		prp->nState = PREFETCH_USED;
+		return -1;
+	}
+
+	while (prp->nState == PREFETCH_LOADING) {
+		PrefetchCond.wait(lock);
+	}
+
+	int nRet = prp->nRet;
+	if (nRet >= 0 && prp->pData) {
+		memcpy(Dest, prp->pData, prp->nWrote);
+		if (pnWrote) {
+			*pnWrote = prp->nWrote;
+		}
+	}
+
+	free(prp->pData);
+	prp->pData = NULL;
+	prp->nState = PREFETCH_USED;
+	nPrefetchPending -= prp->nLen;
+
+	PrefetchCond.notify_all();
+
+	return nRet;
+}
+
+// -----------------------------------------------------------------------------
+// Prepared sets
+//
+// A prepared set is every rom a driver loaded, uncompressed, in one file with the start of each
+// rom on a page boundary and a manifest in front.  It's written the first time a driver is
+// started from its zips, and after that the file is mapped into memory and the roms are copied
+// straight out of it, without opening or inflating the zips.  Processes running the same game
+// share the mapped pages.
+
+#define BZIP_PREPARED_VERSION	(1)
+#define BZIP_PREPARED_ALIGN		(4096)
+
+bool bBzipPrepared = false;
+char szAppPreparedPath[MAX_PATH] = "prepared/";
+
+struct PreparedHeader { char szMagic[8]; unsigned int nVersion; int nBurnVer; char szDrvName[32]; int nRomCount; int nReserved; };
+struct PreparedRom { unsigned int nCrc; int nLen; int nWrote; int nLoaded; unsigned long long nOffset; };
+
+static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i);
+static void BzipFindRoms(bool bootApp);
+
+static const char szPreparedMagic[8] = { 'F', 'B', 'N', 'P', 'R', 'E', 'P', 0 };
+
+#if !defined (_WIN32)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static unsigned char* pPreparedMap = NULL;						// Set we're loading from
+static size_t nPreparedMapLen = 0;
+static struct PreparedRom* PreparedRoms = NULL;
+
+static bool bPreparedZips = false;								// Looked in the zips for roms the set doesn't have
+
+static int nPreparedFile = -1;									// Set we're writing
+static struct PreparedRom* PreparedWriteRoms = NULL;
+static unsigned long long nPreparedWritePos = 0;
+
+static void PreparedName(char* szName, bool bTemp)
+{
+	snprintf(szName, MAX_PATH, "%s%s.fbp%s", szAppPreparedPath, BurnDrvGetTextA(DRV_NAME), bTemp ? ".tmp" : "");
+}
+
+static int PreparedManifestLen()
+{
+	int nLen = sizeof(struct PreparedHeader) + nRomCount * sizeof(struct PreparedRom);
+
+	return (nLen + BZIP_PREPARED_ALIGN - 1) & ~(BZIP_PREPARED_ALIGN - 1);
+}
+
+// Map the driver's prepared set, if it has one that matches its rom list
+static int PreparedOpen()
+{
+	char szName[MAX_PATH];
+	struct stat st;
+
+	PreparedName(szName, false);
+
+	int fd = open(szName, O_RDONLY);
+	if (fd < 0) {
+		return 1;
+	}
+
+	if (fstat(fd, &st) || st.st_size < PreparedManifestLen()) {
+		close(fd);
+		return 1;
+	}
+
+	void* pMap = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (pMap == MAP_FAILED) {
+		return 1;
+	}
+
+	struct PreparedHeader* pph = (struct PreparedHeader*)pMap;
+	struct PreparedRom* ppr = (struct PreparedRom*)(pph + 1);
+	bool bOkay = memcmp(pph->szMagic, szPreparedMagic, sizeof(szPreparedMagic)) == 0 && pph->nVersion == BZIP_PREPARED_VERSION
+		&& pph->nBurnVer == nBurnVer && pph->nRomCount == nRomCount && strncmp(pph->szDrvName, BurnDrvGetTextA(DRV_NAME), sizeof(pph->szDrvName)) == 0;
+
+	for (int i = 0; bOkay && i < nRomCount; i++) {
+		struct BurnRomInfo ri;
+
+		memset(&ri, 0, sizeof(ri));
+		BurnDrvGetRomInfo(&ri, i);
+
+		if (ppr[i].nCrc != ri.nCrc || ppr[i].nLen != ri.nLen) {
+			bOkay = false;
+		}
+		if (ppr[i].nLoaded && (ppr[i].nWrote < 0 || ppr[i].nWrote > (int)ri.nLen || ppr[i].nOffset > (unsigned long long)st.st_size || ppr[i].nOffset + ppr[i].nWrote > (unsigned long long)st.st_size)) {
+			bOkay = false;
+		}
+	}
+
+	if (!bOkay) {
+		munmap(pMap, st.st_size);
+		return 1;
+	}
+
+	pPreparedMap = (unsigned char*)pMap;
+	nPreparedMapLen = st.st_size;
+	PreparedRoms = ppr;
+
+	return 0;
+}
+
+static int PreparedCreate();
+static void PreparedAddRom(int i, unsigned char* Src, int nLen);
+
+static int __cdecl PreparedBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
+{
+	if (i < 0 || i >= nRomCount) {
+		return 1;
+	}
+
+	if (!PreparedRoms[i].nLoaded) {
+		// The driver wants a rom it didn't load when the set was written (e.g. an optional BIOS),
+		// so load it from the zips, and write the set again with it in
+		if (!bPreparedZips) {
+			bPreparedZips = true;
+
+			BzipFindRoms(true);
+			CheckRoms();
+
+			if (nZipsFound && nBzipError == 0 && PreparedCreate() == 0) {
+				for (int j = 0; j < nRomCount; j++) {
+					if (PreparedRoms[j].nLoaded) {
+						PreparedAddRom(j, pPreparedMap + PreparedRoms[j].nOffset, PreparedRoms[j].nWrote);
+					}
+				}
+			}
+		}
+
+		return BzipBurnLoadRom(Dest, pnWrote, i);
+	}
+
+	memcpy(Dest, pPreparedMap + PreparedRoms[i].nOffset, PreparedRoms[i].nWrote);
+	if (pnWrote) {
+		*pnWrote = PreparedRoms[i].nWrote;
+	}
+	PreparedAddRom(i, Dest, PreparedRoms[i].nWrote);			// If the set is being written again
+
+	return 0;
+}
+
+// Start writing a prepared set while the driver loads its roms from the zips
+static int PreparedCreate()
+{
+	char szName[MAX_PATH];
+
+	mkdir(szAppPreparedPath, 0777);
+
+	PreparedName(szName, true);
+
+	nPreparedFile = open(szName, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (nPreparedFile < 0) {
+		return 1;
+	}
+
+	PreparedWriteRoms = (struct PreparedRom*)calloc(nRomCount, sizeof(struct PreparedRom));
+	if (PreparedWriteRoms == NULL) {
+		close(nPreparedFile);
+		nPreparedFile = -1;
+		unlink(szName);
+		return 1;
+	}
+
+	nPreparedWritePos = PreparedManifestLen();
+
+	return 0;
+}
+
+static void PreparedAddRom(int i, unsigned char* Src, int nLen)
+{
+	if (nPreparedFile < 0 || PreparedWriteRoms[i].nLoaded) {
+		return;
+	}
+
+	if (pwrite(nPreparedFile, Src, nLen, nPreparedWritePos) != nLen) {
+		PreparedWriteRoms[i].nLoaded = -1;						// Don't keep the set
+		return;
+	}
+
+	PreparedWriteRoms[i].nWrote = nLen;
+	PreparedWriteRoms[i].nOffset = nPreparedWritePos;
+	PreparedWriteRoms[i].nLoaded = 1;
+
+	nPreparedWritePos = (nPreparedWritePos + nLen + BZIP_PREPARED_ALIGN - 1) & ~(unsigned long long)(BZIP_PREPARED_ALIGN - 1);
+}
+
+// Keep the set being written if every rom the driver needs made it into it
+static void PreparedFinish()
+{
+	char szTemp[MAX_PATH];
+
+	PreparedName(szTemp, true);
+
+	bool bOkay = true;
+	for (int i = 0; i < nRomCount; i++) {
+		struct BurnRomInfo ri;
+
+		memset(&ri, 0, sizeof(ri));
+		BurnDrvGetRomInfo(&ri, i);
+
+		PreparedWriteRoms[i].nCrc = ri.nCrc;
+		PreparedWriteRoms[i].nLen = ri.nLen;
+
+		if (PreparedWriteRoms[i].nLoaded < 0 || (PreparedWriteRoms[i].nLoaded == 0 && (ri.nType & (BRF_OPT | BRF_NODUMP)) == 0 && ri.nLen > 0)) {
+			bOkay = false;
+		}
+	}
+
+	if (bOkay) {
+		struct PreparedHeader ph;
+
+		memset(&ph, 0, sizeof(ph));
+		memcpy(ph.szMagic, szPreparedMagic, sizeof(szPreparedMagic));
+		ph.nVersion = BZIP_PREPARED_VERSION;
+		ph.nBurnVer = nBurnVer;
+		strncpy(ph.szDrvName, BurnDrvGetTextA(DRV_NAME), sizeof(ph.szDrvName) - 1);
+		ph.nRomCount = nRomCount;
+
+		int nManifestLen = nRomCount * sizeof(struct PreparedRom);
+		if (pwrite(nPreparedFile, &ph, sizeof(ph), 0) != sizeof(ph) || pwrite(nPreparedFile, PreparedWriteRoms, nManifestLen, sizeof(ph)) != nManifestLen) {
+			bOkay = false;
+		}
+	}
+
+	if (close(nPreparedFile)) {
+		bOkay = false;
+	}
+	nPreparedFile = -1;
+
+	if (bOkay) {
+		char szName[MAX_PATH];
+
+		PreparedName(szName, false);
+		if (rename(szTemp, szName) == 0) {
+			fprintf(stderr, "Wrote prepared set %s\n", szName);
+		}
+	} else {
+		unlink(szTemp);
+	}
+
+	free(PreparedWriteRoms);
+	PreparedWriteRoms = NULL;
+}
+
+static void PreparedClose()
+{
+	if (nPreparedFile >= 0) {
+		PreparedFinish();
+	}
+
+	if (pPreparedMap) {
+		munmap(pPreparedMap, nPreparedMapLen);
+		pPreparedMap = NULL;
+		nPreparedMapLen = 0;
+	}
+	PreparedRoms = NULL;
+	bPreparedZips = false;
+}
+
+#else
+
+static int PreparedOpen() { return 1; }
+static int __cdecl PreparedBurnLoadRom(unsigned char*, int*, int) { return 1; }
+static int PreparedCreate() { return 1; }
+static void PreparedAddRom(int, unsigned char*, int) { }
+static void PreparedClose() { }
+
+#endif
+
 static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 {
 #if defined (BUILD_WIN32)
@@ -295,6 +774,21 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 		return 1;
 	}
 
+	nRet = PrefetchLoadRom(Dest, pnWrote, i, ri.nLen);
+	if (nRet == 0) {
+		PreparedAddRom(i, Dest, pnWrote ? *pnWrote : ri.nLen);
+		fprintf(stderr, "%s (OK)\n", szText);
+		return 0;
+	}
+	if (nRet > 0) {
+		TCHAR szTemp[128] = _T("");
+		_stprintf(szTemp, _T("%s reading %.30hs from %.30s"), nRet == 2 ? _T("CRC error") : _T("Error"), pszRomName, GetFilenameW(szBzipName[RomFind[i].nZip]));
+		fprintf(stderr, szTemp);
+		AppError(szTemp, 1);
+		return 1;
+	}
+	nRet = 0;
+
 	nWantZip = RomFind[i].nZip;								// Which zip file it is in
 	if (nCurrentZip != nWantZip) {							// If we haven't got the right zip file currently open
 		ZipClose();
@@ -315,46 +809,14 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 		return 1;
 	}
 
+	PreparedAddRom(i, Dest, pnWrote ? *pnWrote : ri.nLen);
 	fprintf(stderr, "%s (OK)\n", szText);
 	return 0;
 }
 
-int BzipOpen(bool bootApp)
+// Find each rom in the driver's zips
+static void BzipFindRoms(bool bootApp)
 {
-	int nMemLen;											// Zip name number
-
-	nZipsFound = 0;											// Haven't found zips yet
-	nTotalSize = 0;
-
-	if (szBzipName == NULL) {
-		return 1;
-	}
-
-	BzipClose();											// Make sure nothing is open
-
-	if(!bootApp) {											// reset information strings
-		BzipText.Reset();
-		BzipDetail.Reset();
-	}
-
-	// Count the number of roms needed
-	for (nRomCount = 0; ; nRomCount++) {
-		if (BurnDrvGetRomInfo(NULL, nRomCount)) {
-			break;
-		}
-	}
-	if (nRomCount <= 0) {
-		return 1;
-	}
-
-	// Create an array for holding lookups for each rom -> zip entries
-	nMemLen = nRomCount * sizeof(struct RomFind);
-	RomFind = (struct RomFind*)malloc(nMemLen);
-	if (RomFind == NULL) {
-		return 1;
-	}
-	memset(RomFind, 0, nMemLen);
-
 	for (int z = 0; z < BZIP_MAX; z++) {
 		char* szName = NULL;
 
@@ -449,6 +911,51 @@ int BzipOpen(bool bootApp)
 		ZipClose();												// Close the last zip file if open
 		nCurrentZip = -1;
 	}
+}
+
+int BzipOpen(bool bootApp)
+{
+	int nMemLen;											// Zip name number
+
+	nZipsFound = 0;											// Haven't found zips yet
+	nTotalSize = 0;
+
+	if (szBzipName == NULL) {
+		return 1;
+	}
+
+	BzipClose();											// Make sure nothing is open
+
+	if(!bootApp) {											// reset information strings
+		BzipText.Reset();
+		BzipDetail.Reset();
+	}
+
+	// Count the number of roms needed
+	for (nRomCount = 0; ; nRomCount++) {
+		if (BurnDrvGetRomInfo(NULL, nRomCount)) {
+			break;
+		}
+	}
+	if (nRomCount <= 0) {
+		return 1;
+	}
+
+	// Create an array for holding lookups for each rom -> zip entries
+	nMemLen = nRomCount * sizeof(struct RomFind);
+	RomFind = (struct RomFind*)malloc(nMemLen);
+	if (RomFind == NULL) {
+		return 1;
+	}
+	memset(RomFind, 0, nMemLen);
+
+	if (!bootApp && bBzipPrepared && PreparedOpen() == 0) {	// Load from the prepared set, only going to the zips for roms it lacks
+		BzipText.Add(_T("Using the prepared set;\n"));
+		BurnExtLoadRom = PreparedBurnLoadRom;
+		return 0;
+	}
+
+	BzipFindRoms(bootApp);
 
 	if (!bootApp) {
 		// Check the roms to see if they code, graphics etc are complete
@@ -492,6 +999,12 @@ int BzipOpen(bool bootApp)
 
 		BurnExtLoadRom = BzipBurnLoadRom;						// Okay to call our function to load each rom
 
+		if (bBzipPrepared && nZipsFound && nBzipError == 0) {
+			PreparedCreate();									// Keep the roms for next time
+		}
+
+		PrefetchInit();											// Start loading them in the background
+
 	} else {
 		return CheckRomsBoot();
 	}
@@ -501,6 +1014,9 @@ int BzipOpen(bool bootApp)
 
 int BzipClose()
 {
+	PrefetchExit();
+	PreparedClose();
+
 	ZipClose();
 	nCurrentZip = -1;											// Close the last zip file if open
 
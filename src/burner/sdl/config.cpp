@@ -45,6 +45,20 @@ int ConfigAppLoad()
 #endif
 		VAR(bVidScanlines);
 		VAR(nAudSampleRate[0]);
+		VAR(bRunProfileZones);
+		VAR(bRunRewind);
+		VAR(nRunRewindSize);
+		VAR(nRunRewindInterval);
+		VAR(nRunAhead);
+		VAR(bBurnDecryptCache);
+		STR(szBurnDecryptCachePath);
+		VAR(bBzipPrepared);
+		STR(szAppPreparedPath);
+		VAR(bBurnTransferDirtyRows);
+		VAR(bBurnVideoPipeline);
+		VAR(bBurnIdleDetect);
+		VAR(bBurnSh2Recompiler);
+		VAR(bBurnArm7Recompiler);
 
 		// Other
 		STR(szAppRomPaths[0]);
@@ -108,6 +122,34 @@ int ConfigAppSave()
 	fprintf(f,"\n// If non-zero, enable scanlines\n");
 	VAR(bVidScanlines);
 	VAR(nAudSampleRate[0]);
+	fprintf(f,"\n// If non-zero, time the cpu/draw/sound profiling zones and write them to " PROFILE_ZONES_CSV "\n");
+	VAR(bRunProfileZones);
+	fprintf(f,"\n// If non-zero, keep a rewind history (hold backspace to rewind)\n");
+	VAR(bRunRewind);
+	fprintf(f,"\n// Memory to use for the rewind history, in megabytes\n");
+	VAR(nRunRewindSize);
+	fprintf(f,"\n// Take a rewind snapshot every n frames\n");
+	VAR(nRunRewindInterval);
+	fprintf(f,"\n// Run-ahead frames, to hide the game's own input lag (0 = off)\n");
+	VAR(nRunAhead);
+	fprintf(f,"\n// If non-zero, keep decrypted roms (CPS2, CPS3, Neo Geo) on disk so they load faster next time\n");
+	VAR(bBurnDecryptCache);
+	fprintf(f,"\n// Where to keep them (include trailing slash)\n");
+	STR(szBurnDecryptCachePath);
+	fprintf(f,"\n// If non-zero, keep every game's roms uncompressed in one file the first time it's started, and boot from that\n");
+	VAR(bBzipPrepared);
+	fprintf(f,"\n// Where to keep the prepared sets (include trailing slash)\n");
+	STR(szAppPreparedPath);
+	fprintf(f,"\n// If non-zero, only redraw the lines of the screen that changed since the last frame\n");
+	VAR(bBurnTransferDirtyRows);
+	fprintf(f,"\n// If non-zero, draw each frame on another thread while the next one runs (a frame of extra lag)\n");
+	VAR(bBurnVideoPipeline);
+	fprintf(f,"\n// If non-zero, skip the rest of a cpu's timeslice when it's spinning in an idle loop (68000 and Z80)\n");
+	fprintf(f,"// Loops found are listed in <nvram path>/<game>.idle\n");
+	VAR(bBurnIdleDetect);
+	fprintf(f,"\n// If non-zero, run the SH-2 (CPS3, Psikyo SH) and ARM7 (PGM) cpus through the x86-64 recompilers, if built with them\n");
+	VAR(bBurnSh2Recompiler);
+	VAR(bBurnArm7Recompiler);
 
 	fprintf(f,"\n// The paths to search for rom zips. (include trailing backslash)\n");
 	STR(szAppRomPaths[0]);
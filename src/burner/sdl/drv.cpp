@@ -113,6 +113,8 @@ int DrvExit()
 		}
 	}
 
+	BurnStateRawExit();
+
 	BurnExtLoadRom = NULL;
 
 	bDrvOkay = 0;					// Stop using the BurnDrv functions
@@ -50,18 +50,15 @@ int main(int argc, char *argv[])
 
 	if (argc == 2)
 	{
-		for (i = 0; i < nBurnDrvCount; i++) {
-			//nBurnDrvSelect[0] = i;
-			nBurnDrvActive = i;
-			if (strcmp(BurnDrvGetTextA(0), argv[1]) == 0) {
-				break;
-			}
-		}
+		INT32 nDrv = BurnDrvFind(argv[1]);
 
-		if (i == nBurnDrvCount) {
+		if (nDrv < 0) {
 			printf("%s is not supported by FinalBurn Neo.\n",argv[1]);
 			return 1;
 		}
+
+		i = nDrv;
+		nBurnDrvActive = i;
 	}
 
 	bCheatsAllowed = false;
@@ -5,6 +5,15 @@ bool bAltPause = 0;
 
 int bAlwaysDrawFrames = 0;
 
+bool bRunProfileZones = false;				// Time the profiling zones and write them to PROFILE_ZONES_CSV
+
+bool bRunRewind = false;					// Keep a rewind history
+int nRunRewindSize = 64;					// Rewind history size in MB
+int nRunRewindInterval = 2;					// Rewind snapshot every n frames
+bool bRunRewinding = false;					// Rewind key held
+
+int nRunAhead = 0;							// Frames to run ahead
+
 static bool bShowFPS = false;
 
 int counter;								// General purpose variable used when debugging
@@ -87,8 +96,21 @@ static int RunFrame(int bDraw, int bPause)
 		nFramesEmulated++;
 		nCurrentFrame++;
 		GetInput(true);					// Update inputs
+		if (bRunRewinding) {
+			RewindStep();					// Go back to the previous snapshot before running the frame
+		} else {
+			RewindFrame();					// Take a snapshot of the state the frame starts from
+		}
+	}
+	if (nRunAhead > 0 && !bPause && !bRunRewinding) {
+		if (bDraw) {
+			nFramesRendered++;
+		}
+		if (RunAheadFrame(nRunAhead, bDraw)) {
+			AudBlankSound();
+		}
 	}
-	if (bDraw) {
+	else if (bDraw) {
 		nFramesRendered++;
 		if (VidFrame()) {					// Do one frame
 			AudBlankSound();
@@ -98,6 +120,10 @@ static int RunFrame(int bDraw, int bPause)
 		pBurnDraw = NULL;					// Make sure no image is drawn
 		BurnDrvFrame();
 	}
+	if (!bPause) {
+		ProfileZonesFrame();
+	}
+
 	bPrevPause = bPause;
 	bPrevDraw = bDraw;
 
@@ -208,6 +234,14 @@ int RunInit()
 
 	RunReset();
 
+	if (bRunProfileZones) {
+		ProfileZonesInit(PROFILE_ZONES_CSV);
+	}
+
+	if (bRunRewind) {
+		RewindInit(nRunRewindSize << 20, nRunRewindInterval);
+	}
+
 	return 0;
 }
 
@@ -215,6 +249,9 @@ int RunExit()
 {
 	nNormalLast = 0;
 
+	ProfileZonesExit();
+	RewindExit();
+
 	return 0;
 }
 
@@ -235,6 +272,12 @@ int RunMessageLoop()
                 case SDL_QUIT: /* Windows was closed */
                     quit = 1;
                     break;
+                case SDL_KEYDOWN:
+                case SDL_KEYUP:
+                    if (event.key.keysym.sym == SDLK_BACKSPACE) {
+                        bRunRewinding = (event.type == SDL_KEYDOWN);
+                    }
+                    break;
             }
         }
 
@@ -169,3 +169,102 @@ INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll)
 
 	return 0;
 }
+
+// -----------------------------------------------------------------------------
+// Raw (uncompressed) states, for features that take a state every frame
+//
+// The state is copied area by area into one buffer, which is kept between calls and only
+// grown if the driver's state gets bigger, so there's no allocation or deflate per call.
+
+static UINT8* pRawState = NULL;
+static INT32 nRawStateSize = 0;							// allocated
+static INT32 nRawStateLen = 0;							// used by the last state saved
+static INT32 nRawStatePos = 0;
+static UINT8* pRawStateLoad = NULL;
+static INT32 nRawStateLoadLen = 0;
+
+static INT32 __cdecl StateSaveRawAcb(struct BurnArea* pba)
+{
+	if (nRawStatePos + (INT32)pba->nLen <= nRawStateSize) {
+		memcpy(pRawState + nRawStatePos, pba->Data, pba->nLen);
+	}
+	nRawStatePos += pba->nLen;								// keep counting, so we know what size to make the buffer
+
+	return 0;
+}
+
+static INT32 __cdecl StateLoadRawAcb(struct BurnArea* pba)
+{
+	if (nRawStatePos + (INT32)pba->nLen <= nRawStateLoadLen) {
+		memcpy(pba->Data, pRawStateLoad + nRawStatePos, pba->nLen);
+	}
+	nRawStatePos += pba->nLen;
+
+	return 0;
+}
+
+// Save the whole state, *pState is valid until the next call or BurnStateRawExit()
+INT32 BurnStateSaveRaw(UINT8** pState, INT32* pnLen)
+{
+	nRawStatePos = 0;
+	BurnAcb = StateSaveRawAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+
+	if (nRawStatePos > nRawStateSize) {
+		// First call, or the state has grown: make the buffer big enough and take it again
+		UINT8* pNew = (UINT8*)realloc(pRawState, nRawStatePos);
+		if (pNew == NULL) {
+			return 1;
+		}
+		pRawState = pNew;
+		nRawStateSize = nRawStatePos;
+
+		nRawStatePos = 0;
+		BurnAreaScan(ACB_FULLSCAN | ACB_READ, NULL);
+	}
+
+	nRawStateLen = nRawStatePos;
+
+	if (pState) {
+		*pState = pRawState;
+	}
+	if (pnLen) {
+		*pnLen = nRawStateLen;
+	}
+
+	return 0;
+}
+
+// Load a state saved by BurnStateSaveRaw(), or the last one saved if pState is NULL
+INT32 BurnStateLoadRaw(const UINT8* pState, INT32 nLen)
+{
+	if (pState == NULL) {
+		pState = pRawState;
+		nLen = nRawStateLen;
+	}
+	if (pState == NULL || nLen <= 0) {
+		return 1;
+	}
+
+	pRawStateLoad = (UINT8*)pState;
+	nRawStateLoadLen = nLen;
+
+	nRawStatePos = 0;
+	BurnAcb = StateLoadRawAcb;
+	BurnAreaScan(ACB_FULLSCAN | ACB_WRITE, NULL);
+
+	pRawStateLoad = NULL;
+
+	return (nRawStatePos == nLen) ? 0 : 1;
+}
+
+// Free the buffer, call when the driver exits
+INT32 BurnStateRawExit()
+{
+	free(pRawState);
+	pRawState = NULL;
+	nRawStateSize = 0;
+	nRawStateLen = 0;
+
+	return 0;
+}
@@ -398,3 +398,79 @@ INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, I
 
 	return 0;
 }
+
+// Zip files opened separately from the one above, so several entries can be loaded at the same
+// time from different threads (one handle per thread).  Only .zip is supported, since a .7z has
+// to be decompressed from the start of each solid block anyway.
+struct ZipHandle {
+	unzFile Zip;
+	INT32 nCurrFile;
+};
+
+void* ZipHandleOpen(char* szZip)
+{
+	if (szZip == NULL) return NULL;
+
+	char szFileName[MAX_PATH];
+
+	sprintf(szFileName, "%s.zip", szZip);
+	unzFile Zip = unzOpen(szFileName);
+	if (Zip == NULL) return NULL;
+
+	struct ZipHandle* pzh = (struct ZipHandle*)malloc(sizeof(struct ZipHandle));
+	if (pzh == NULL) {
+		unzClose(Zip);
+		return NULL;
+	}
+
+	pzh->Zip = Zip;
+	pzh->nCurrFile = 0;
+	unzGoToFirstFile(Zip);
+
+	return pzh;
+}
+
+INT32 ZipHandleClose(void* pHandle)
+{
+	struct ZipHandle* pzh = (struct ZipHandle*)pHandle;
+
+	if (pzh) {
+		unzClose(pzh->Zip);
+		free(pzh);
+	}
+
+	return 0;
+}
+
+INT32 ZipHandleLoadFile(void* pHandle, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
+{
+	struct ZipHandle* pzh = (struct ZipHandle*)pHandle;
+
+	if (pzh == NULL) return 1;
+
+	INT32 nRet = 0;
+
+	if (nEntry < pzh->nCurrFile) {
+		nRet = unzGoToFirstFile(pzh->Zip);
+		if (nRet != UNZ_OK) return 1;
+		pzh->nCurrFile = 0;
+	}
+
+	while (pzh->nCurrFile < nEntry) {
+		nRet = unzGoToNextFile(pzh->Zip);
+		if (nRet != UNZ_OK) return 1;
+		pzh->nCurrFile++;
+	}
+
+	nRet = unzOpenCurrentFile(pzh->Zip);
+	if (nRet != UNZ_OK) return 1;
+
+	nRet = unzReadCurrentFile(pzh->Zip, Dest, nLen);
+	if (nRet >= 0 && pnWrote != NULL) *pnWrote = nRet;
+
+	nRet = unzCloseCurrentFile(pzh->Zip);
+	if (nRet == UNZ_CRCERROR) return 2;
+	if (nRet != UNZ_OK) return 1;
+
+	return 0;
+}
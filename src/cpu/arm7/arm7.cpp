@@ -35,6 +35,13 @@
     **
 *****************************************************************************/
 #include "burnint.h"
+
+#ifdef ARM7_X64_DRC
+// before arm7core.h, whose R15 macro would clash with xbyak's register names
+#include <vector>
+#include "../mips3/x64/xbyak/xbyak.h"
+#endif
+
 #include "arm7core.h"
 #include "arm7_intf.h"
 
@@ -91,6 +98,8 @@ static int ARM7_ICOUNT;
 static int total_cycles = 0;
 static int curr_cycles = 0;
 static int end_run = 0;
+bool bBurnArm7Recompiler = false;
+static bool arm7_use_recompiler = false;
 
 void Arm7Open(int ) 
 {
@@ -186,14 +195,51 @@ static void arm7_exit()
     
 }*/
 
+/* include the arm7 core execute code */
+static void arm7_execute()
+{
+#include "arm7exec.c"
+}
+
+#ifdef ARM7_X64_DRC
+#include "arm7_x64.h"
+#endif
+
 int Arm7Run(int cycles)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_ARM7);
+
 #if defined FBNEO_DEBUG
 	if (!DebugCPU_ARM7Initted) bprintf(PRINT_ERROR, _T("Arm7Run called without init\n"));
 #endif
 
-/* include the arm7 core execute code */
-#include "arm7exec.c"
+#ifdef ARM7_X64_DRC
+	if (arm7_use_recompiler && cycles > 0) {
+		return Arm7RunDrc(cycles);
+	}
+#endif
+
+	ARM7_ICOUNT = cycles;
+	curr_cycles = cycles;
+	end_run = 0;
+
+	do
+	{
+		arm7_execute();
+	} while (ARM7_ICOUNT > 0 && !end_run);
+
+	cycles = curr_cycles - ARM7_ICOUNT;
+	total_cycles += cycles;
+	curr_cycles = ARM7_ICOUNT = 0;
+
+	return cycles;
+}
+
+int Arm7UseRecompiler(bool use)
+{
+	arm7_use_recompiler = use;
+
+	return 0;
 }
 
 void arm7_set_irq_line(int irqline, int state)
@@ -0,0 +1,1403 @@
+// ARM7 x86-64 recompiler, included by arm7.cpp when ARM7_X64_DRC is defined
+//
+// Straight runs of ARM or Thumb code, up to a branch, are translated to x86-64 with xbyak and run
+// as one block.  The registers stay in the ARM7_REGS struct (rbx points at it), loads and stores
+// go straight to the memory mapped with Arm7MapMemory(), and anything else - the rarer
+// instructions, and accesses that go to the read and write handlers - is run by the interpreter's
+// own arm7_execute().
+//
+// Cycles are counted exactly as the interpreter counts them.  A block is only run when no exception
+// is waiting to be taken and the cycles left are more than it takes, and it stops after any
+// interpreted instruction that doesn't go on to the next one, changes the mode, raises an
+// exception, ends the run or burns cycles.  So a block gives the same result as stepping through it.
+//
+// A block checks the code it was made from is still there each time it's entered, so code written
+// by the 68000 or loaded with a state is picked up, and blocks are kept by the memory their page
+// was fetched from, so banks switched with Arm7MapMemory() find their own.  A store into the block
+// that's running stops it after that instruction.
+
+#define ARM7_DRC_CODE_SIZE		(1024 * 1024 * 8)
+#define ARM7_DRC_BLOCK_MAX		32								// instructions per block
+#define ARM7_DRC_SHIFT			12								// pages of the memory map, as arm7_intf.cpp
+#define ARM7_DRC_PAGEM			((1 << ARM7_DRC_SHIFT) - 1)
+#define ARM7_DRC_TABLE_SHIFT	16								// block tables cover 64k each
+#define ARM7_DRC_TABLE_COUNT	(0x80000000 >> ARM7_DRC_TABLE_SHIFT)
+
+#define DRC_REG(n)				dword[rbx + (UINT32)(offsetof(ARM7_REGS, sArmRegister) + (n) * 4)]
+#define DRC_R(n)				DRC_REG(m_pRegs[n])
+#define DRC_PC					DRC_REG(eR15)
+#define DRC_CPSR				DRC_REG(eCPSR)
+#define DRC_ICOUNT				dword[rbp]
+#define DRC_LEAVE				dword[r14]
+
+// CompileArm() and CompileThumb() results
+enum { DRC_NEXT = 0, DRC_END };
+
+// Operand2() carry out
+enum { DRC_CARRY_KEEP = 0, DRC_CARRY_0, DRC_CARRY_1, DRC_CARRY_R8 };
+
+extern UINT8** arm7_drc_membase(INT32 nType);
+extern UINT32 arm7_drc_idle_loop();
+
+struct Arm7DrcBlock {
+	Arm7DrcBlock* pNext;				// others at the same pc
+	UINT8* pHost;						// memory the page was fetched from
+	UINT32 nKey;						// cpsr mode and Thumb bit
+	INT32 nCycles;						// the most it takes up to its last instruction
+	void* pCode;						// NULL: step through with the interpreter
+};
+
+class Arm7Drc;
+static Arm7Drc* arm7_drc = NULL;
+static INT32 arm7_drc_leave;			// set to leave recompiled code early
+
+// An exception would be taken after the next instruction
+static inline INT32 arm7_drc_irq_ready()
+{
+	UINT32 cpsr = GET_CPSR;
+
+	return ARM7.pendingAbtD || (ARM7.pendingFiq && (cpsr & F_MASK) == 0) || (ARM7.pendingIrq && (cpsr & I_MASK) == 0) ||
+		ARM7.pendingAbtP || ARM7.pendingUnd || ARM7.pendingSwi;
+}
+
+// Called by the recompiled code to run an instruction with the interpreter.  The block carries on
+// if it went on to nNext and there are more than nRemain cycles left for the rest of the block.
+static void arm7_drc_execute(UINT32 nNext, INT32 nRemain)
+{
+	UINT32 nKey = GET_CPSR & (T_MASK | MODE_FLAG);
+
+	arm7_execute();
+
+	if (end_run || R15 != nNext || (GET_CPSR & (T_MASK | MODE_FLAG)) != nKey || ARM7_ICOUNT <= nRemain || arm7_drc_irq_ready()) {
+		arm7_drc_leave = 1;
+	}
+}
+
+// The recompiler -------------------------------------------------------------
+
+class Arm7Drc : public Xbyak::CodeGenerator
+{
+public:
+	Arm7Drc();
+	~Arm7Drc();
+
+	inline Arm7DrcBlock* GetBlock(UINT32 nPc, UINT32 nKey)
+	{
+		// Odd pcs would share the table entry of the one below, they're left to the interpreter
+		if (nPc & 1) {
+			return NULL;
+		}
+
+		UINT8* pHost = (nPc & 0x80000000) ? NULL : m_pFetch[nPc >> ARM7_DRC_SHIFT];
+		Arm7DrcBlock** pTable = m_pTable[(nPc & 0x7fffffff) >> ARM7_DRC_TABLE_SHIFT];
+
+		if (pTable) {
+			for (Arm7DrcBlock* pBlock = pTable[(nPc & 0xffff) >> 1]; pBlock; pBlock = pBlock->pNext) {
+				if (pBlock->nKey == nKey && pBlock->pHost == pHost) {
+					return pBlock;
+				}
+			}
+		}
+
+		return NewBlock(nPc, nKey, pHost);
+	}
+
+	void Drop(UINT32 nPc, Arm7DrcBlock* pBlock);
+	void Flush();
+
+private:
+	UINT8** m_pRead;
+	UINT8** m_pWrite;
+	UINT8** m_pFetch;
+	Arm7DrcBlock** m_pTable[ARM7_DRC_TABLE_COUNT];		// blocks by pc, a table for each 64k run from
+	std::vector<Arm7DrcBlock*> m_Blocks;
+
+	// The block being compiled
+	const int* m_pRegs;					// sRegisterTable[] for its mode
+	UINT8* m_pHost;
+	bool m_bThumb;
+	INT32 m_nSize;						// of an instruction
+	UINT32 m_nStart;
+	UINT32 m_nSpan;						// bytes a store has to miss to leave the block running
+	UINT32 m_nAddr;						// instruction being compiled
+	INT32 m_nCur;						// and the cycles it takes
+	INT32 m_nPend;						// cycles not yet taken off
+	INT32 m_nCycles;					// the whole block's, not counting interpreted instructions
+	INT32 m_nLastCycles;				// the last instruction's
+	Xbyak::Label* m_pLeave;
+	Xbyak::Label* m_pCheck;				// after each interpreted instruction, to check the rest of the block
+	Xbyak::Label* m_pBack;
+	UINT32 m_nCheck[ARM7_DRC_BLOCK_MAX];	// and the instruction after it
+	INT32 m_nChecks;
+	std::vector<std::pair<UINT8*, INT32> > m_Remain;	// cycle counts for arm7_drc_execute() to fill in
+
+	Arm7DrcBlock* NewBlock(UINT32 nPc, UINT32 nKey, UINT8* pHost);
+	void* Compile(UINT32 nPc, UINT32 nKey, UINT8* pHost, INT32* pnCycles);
+	INT32 CompileArm(UINT32 nAddr);
+	INT32 CompileThumb(UINT32 nAddr);
+
+	inline UINT32 ReadArm(UINT32 nAddr)
+	{
+		return *(UINT32*)(m_pHost + (nAddr & (ARM7_DRC_PAGEM & ~3)));
+	}
+	inline UINT32 ReadThumb(UINT32 nAddr)
+	{
+		return *(UINT16*)(m_pHost + (nAddr & (ARM7_DRC_PAGEM & ~1)));
+	}
+
+	void Verify(UINT32 nFrom, UINT32 nTo, Xbyak::Label& lFail);
+	void Prolog();
+	void Epilog();
+	void Pending(INT32 nCycles);
+	void TakePending();
+	void Done(INT32 nCycles);
+	void EndBlock(UINT32 nPc, INT32 nCycles);
+	void Call(void* pFunc);
+	void Step(INT32 nDone);
+	INT32 Fallback();
+	void Page(const Xbyak::Reg64& rMap, Xbyak::Label& lSlow);
+	void Load(INT32 nSize);
+	void Store(INT32 nSize);
+	void Transfer(bool bLoad, INT32 nSize, INT32 nSign, UINT32 rd);
+	void Slow(Xbyak::Label& lSlow, bool bStore);
+	void Condition(UINT32 nCond, Xbyak::Label& lSkip);
+	void LoadReg(const Xbyak::Reg32& r, INT32 n, UINT32 nPc);
+	void StoreNZ(UINT32 nMask);
+	void StoreNZC();
+	void StoreNZCV(bool bSub);
+	void StoreAdc();
+
+	INT32 Operand2(UINT32 insn, bool bCarry);
+	void Alu(UINT32 insn);
+	void MemSingle(UINT32 insn, Xbyak::Label& lSlow);
+	void MemHalf(UINT32 insn, Xbyak::Label& lSlow);
+	void Mul(UINT32 insn);
+};
+
+Arm7Drc::Arm7Drc() : Xbyak::CodeGenerator(ARM7_DRC_CODE_SIZE)
+{
+	m_pRead = arm7_drc_membase(0);
+	m_pWrite = arm7_drc_membase(1);
+	m_pFetch = arm7_drc_membase(2);
+	memset(m_pTable, 0, sizeof(m_pTable));
+	m_pLeave = m_pCheck = m_pBack = NULL;
+}
+
+Arm7Drc::~Arm7Drc()
+{
+	Flush();
+}
+
+void Arm7Drc::Flush()
+{
+	reset();
+
+	for (INT32 i = 0; i < ARM7_DRC_TABLE_COUNT; i++) {
+		if (m_pTable[i]) {
+			free(m_pTable[i]);
+			m_pTable[i] = NULL;
+		}
+	}
+
+	for (UINT32 i = 0; i < m_Blocks.size(); i++) {
+		delete m_Blocks[i];
+	}
+	m_Blocks.clear();
+}
+
+// The code has changed since the block was made, the next GetBlock() makes a new one
+void Arm7Drc::Drop(UINT32 nPc, Arm7DrcBlock* pBlock)
+{
+	Arm7DrcBlock** ppBlock = &m_pTable[(nPc & 0x7fffffff) >> ARM7_DRC_TABLE_SHIFT][(nPc & 0xffff) >> 1];
+
+	while (*ppBlock != pBlock) {
+		ppBlock = &(*ppBlock)->pNext;
+	}
+	*ppBlock = pBlock->pNext;
+
+	pBlock->pNext = NULL;
+}
+
+Arm7DrcBlock* Arm7Drc::NewBlock(UINT32 nPc, UINT32 nKey, UINT8* pHost)
+{
+	Arm7DrcBlock* pBlock = new Arm7DrcBlock;
+
+	pBlock->pHost = pHost;
+	pBlock->nKey = nKey;
+	pBlock->nCycles = 0;
+
+	try {
+		pBlock->pCode = Compile(nPc, nKey, pHost, &pBlock->nCycles);
+	} catch (Xbyak::Error& e) {
+		Flush();
+
+		if (e != Xbyak::ERR_CODE_IS_TOO_BIG) {
+			bprintf(PRINT_ERROR, _T("ARM7 recompiler error %d at %08x\n"), (INT32)e, nPc);
+			pBlock->pCode = NULL;
+		} else {
+			// Out of room, start again
+			try {
+				pBlock->pCode = Compile(nPc, nKey, pHost, &pBlock->nCycles);
+			} catch (Xbyak::Error&) {
+				pBlock->pCode = NULL;
+			}
+		}
+	}
+
+	Arm7DrcBlock**& pTable = m_pTable[(nPc & 0x7fffffff) >> ARM7_DRC_TABLE_SHIFT];
+	if (pTable == NULL) {
+		pTable = (Arm7DrcBlock**)calloc((1 << ARM7_DRC_TABLE_SHIFT) / 2, sizeof(Arm7DrcBlock*));
+	}
+	pBlock->pNext = pTable[(nPc & 0xffff) >> 1];
+	pTable[(nPc & 0xffff) >> 1] = pBlock;
+
+	m_Blocks.push_back(pBlock);
+
+	return pBlock;
+}
+
+void* Arm7Drc::Compile(UINT32 nPc, UINT32 nKey, UINT8* pHost, INT32* pnCycles)
+{
+	UINT32 nMode = nKey & MODE_FLAG;
+
+	m_bThumb = (nKey & T_MASK) != 0;
+	m_nSize = m_bThumb ? 2 : 4;
+
+	// Fetches through handlers, misaligned pcs and the undefined modes are left to the interpreter
+	if (pHost == NULL || (nPc & (m_nSize - 1)) || (nPc & 0x80000000) || sRegisterTable[nMode][eR15] != eR15) {
+		return NULL;
+	}
+
+	m_pRegs = sRegisterTable[nMode];
+	m_pHost = pHost;
+	m_nStart = nPc;
+	m_nSpan = ARM7_DRC_BLOCK_MAX * m_nSize;
+	if ((nPc & ARM7_DRC_PAGEM) + m_nSpan > ARM7_DRC_PAGEM + 1) {
+		m_nSpan = ARM7_DRC_PAGEM + 1 - (nPc & ARM7_DRC_PAGEM);
+	}
+	m_nPend = m_nCycles = m_nLastCycles = 0;
+	m_Remain.clear();
+
+	Xbyak::Label lBody, lLeave, lStale, lVerify;
+	Xbyak::Label lCheck[ARM7_DRC_BLOCK_MAX], lBack[ARM7_DRC_BLOCK_MAX];
+	m_pLeave = &lLeave;
+	m_pCheck = lCheck;
+	m_pBack = lBack;
+	m_nChecks = 0;
+
+	void* pCode = (void*)getCurr();
+
+	Prolog();
+	jmp(lVerify, T_NEAR);
+	L(lBody);
+
+	// The idle loop hack is in the fetch, so the interpreter runs that instruction
+	UINT32 nIdle = arm7_drc_idle_loop();
+
+	UINT32 nAddr = nPc;
+	for (INT32 nCount = 0; ; nCount++) {
+		if (nCount == ARM7_DRC_BLOCK_MAX || ((nAddr ^ nPc) >> ARM7_DRC_SHIFT)) {
+			EndBlock(nAddr, 0);
+			break;
+		}
+
+		m_nAddr = nAddr;
+
+		INT32 nRet;
+		if (nAddr == nIdle) {
+			nRet = Fallback();
+		} else {
+			nRet = m_bThumb ? CompileThumb(nAddr) : CompileArm(nAddr);
+		}
+
+		nAddr += m_nSize;
+
+		if (nRet == DRC_END) {
+			break;
+		}
+	}
+
+	L(lLeave);
+	xor_(eax, eax);
+	Epilog();
+
+	// The code has been changed
+	L(lStale);
+	mov(eax, 1);
+	Epilog();
+
+	L(lVerify);
+	Verify(nPc, nAddr, lStale);
+	jmp(lBody, T_NEAR);
+
+	// An interpreted instruction can write anywhere, leave if it changed what comes after it
+	for (INT32 i = 0; i < m_nChecks; i++) {
+		L(lCheck[i]);
+		Verify(m_nCheck[i], nAddr, lLeave);
+		jmp(lBack[i], T_NEAR);
+	}
+
+	// The cycles the rest of the block can take after each interpreted instruction
+	*pnCycles = m_nCycles - m_nLastCycles;
+	for (UINT32 i = 0; i < m_Remain.size(); i++) {
+		INT32 nRemain = *pnCycles - m_Remain[i].second;
+		memcpy(m_Remain[i].first, &nRemain, sizeof(INT32));
+	}
+
+	m_pLeave = m_pCheck = m_pBack = NULL;
+
+	return pCode;
+}
+
+// Code generation helpers ----------------------------------------------------
+
+#if defined (_WIN64)
+ #define DRC_ARG1		ecx
+ #define DRC_ARG2		edx
+#else
+ #define DRC_ARG1		edi
+ #define DRC_ARG2		esi
+#endif
+
+// Jump to lFail if the code from nFrom to nTo isn't what the block was made from
+void Arm7Drc::Verify(UINT32 nFrom, UINT32 nTo, Xbyak::Label& lFail)
+{
+	if (nFrom == nTo) {
+		return;
+	}
+
+	mov(rax, (size_t)m_pHost);
+	for (UINT32 a = nFrom; a != nTo; a += m_nSize) {
+		if (m_bThumb) {
+			cmp(word[rax + (a & ARM7_DRC_PAGEM)], (INT16)ReadThumb(a));	// xbyak wants 16 bit immediates sign extended
+		} else {
+			cmp(dword[rax + (a & ARM7_DRC_PAGEM)], ReadArm(a));
+		}
+		jne(lFail, T_NEAR);
+	}
+}
+
+void Arm7Drc::Prolog()
+{
+	push(rbx);
+	push(rbp);
+	push(r12);
+	push(r13);
+	push(r14);
+	sub(rsp, 32);		// keeps the stack aligned, and the shadow space for Win64 calls
+
+	mov(rbx, (size_t)&ARM7);
+	mov(rbp, (size_t)&ARM7_ICOUNT);
+	mov(r12, (size_t)m_pRead);
+	mov(r13, (size_t)m_pWrite);
+	mov(r14, (size_t)&arm7_drc_leave);
+}
+
+void Arm7Drc::Epilog()
+{
+	add(rsp, 32);
+	pop(r14);
+	pop(r13);
+	pop(r12);
+	pop(rbp);
+	pop(rbx);
+	ret();
+}
+
+void Arm7Drc::Pending(INT32 nCycles)
+{
+	if (nCycles) sub(DRC_ICOUNT, nCycles);
+}
+
+// Before code that can go two ways
+void Arm7Drc::TakePending()
+{
+	Pending(m_nPend);
+	m_nPend = 0;
+}
+
+// Count the instruction just compiled
+void Arm7Drc::Done(INT32 nCycles)
+{
+	m_nPend += nCycles;
+	m_nCycles += nCycles;
+	m_nLastCycles = nCycles;
+}
+
+// Leave for nPc, after the cycles still pending and nCycles more
+void Arm7Drc::EndBlock(UINT32 nPc, INT32 nCycles)
+{
+	mov(DRC_PC, nPc);
+	Pending(m_nPend + nCycles);
+	xor_(eax, eax);
+	Epilog();
+}
+
+void Arm7Drc::Call(void* pFunc)
+{
+	mov(rax, (size_t)pFunc);
+	call(rax);
+}
+
+// Run this instruction with the interpreter, leaving the block if it doesn't go on to the next one,
+// there aren't enough cycles left for the rest of the block or it wrote over the rest.  nDone is the
+// block's cycles so far.
+void Arm7Drc::Step(INT32 nDone)
+{
+	mov(DRC_PC, m_nAddr);
+	mov(DRC_ARG1, m_nAddr + m_nSize);
+	mov(DRC_ARG2, 0x7fffffff);
+	m_Remain.push_back(std::make_pair((UINT8*)getCurr() - 4, nDone));
+	Call((void*)arm7_drc_execute);
+
+	cmp(DRC_LEAVE, 0);
+	jne(*m_pLeave, T_NEAR);
+
+	m_nCheck[m_nChecks] = m_nAddr + m_nSize;
+	jmp(m_pCheck[m_nChecks], T_NEAR);
+	L(m_pBack[m_nChecks]);
+	m_nChecks++;
+}
+
+// An instruction the recompiler doesn't do
+INT32 Arm7Drc::Fallback()
+{
+	TakePending();
+	Step(m_nCycles);
+
+	// Its cycles aren't known until it's run, so it counts as none and the cycles left are
+	// checked after it instead
+	Done(0);
+
+	return DRC_NEXT;
+}
+
+// The memory for the address in ecx into r8, or on to lSlow if it's handled
+void Arm7Drc::Page(const Xbyak::Reg64& rMap, Xbyak::Label& lSlow)
+{
+	mov(eax, ecx);
+	and_(eax, 0x7fffffff);
+	shr(eax, ARM7_DRC_SHIFT);
+	mov(r8, qword[rMap + rax * 8]);
+	test(r8, r8);
+	jz(lSlow, T_NEAR);
+}
+
+// Read from the address in ecx and the memory in r8 into eax, as arm7_cpu_read8() etc.
+void Arm7Drc::Load(INT32 nSize)
+{
+	mov(eax, ecx);
+
+	if (nSize == 1) {
+		and_(eax, ARM7_DRC_PAGEM);
+		movzx(eax, byte[r8 + rax]);
+	}
+	if (nSize == 2) {
+		// An odd address reads the halfword with its bytes swapped
+		Xbyak::Label lEven;
+
+		and_(eax, ARM7_DRC_PAGEM & ~1);
+		movzx(eax, word[r8 + rax]);
+		test(cl, 1);
+		jz(lEven);
+		rol(ax, 8);
+		L(lEven);
+	}
+	if (nSize == 4) {
+		// A misaligned address reads the word rotated
+		and_(eax, ARM7_DRC_PAGEM & ~3);
+		mov(eax, dword[r8 + rax]);
+		and_(ecx, 3);
+		shl(ecx, 3);
+		ror(eax, cl);
+	}
+}
+
+// Write edx to the address in ecx and the memory in r8, as arm7_cpu_write8() etc.
+void Arm7Drc::Store(INT32 nSize)
+{
+	Xbyak::Label lDone;
+
+	mov(eax, ecx);
+	and_(eax, ARM7_DRC_PAGEM & ~(nSize - 1));
+	if (nSize == 1) mov(byte[r8 + rax], dl);
+	if (nSize == 2) mov(word[r8 + rax], dx);
+	if (nSize == 4) mov(dword[r8 + rax], edx);
+
+	// Into the code of this block?
+	add(r8, rax);
+	mov(r9, (size_t)(m_pHost + (m_nStart & ARM7_DRC_PAGEM)));
+	sub(r8, r9);
+	cmp(r8, m_nSpan);
+	jae(lDone);
+	mov(DRC_LEAVE, 1);
+	L(lDone);
+}
+
+// A load into rd or a store from it, at the address in ecx
+void Arm7Drc::Transfer(bool bLoad, INT32 nSize, INT32 nSign, UINT32 rd)
+{
+	if (bLoad) {
+		Load(nSize);
+		if (nSign && nSize == 1) movsx(eax, al);
+		if (nSign && nSize == 2) movsx(eax, ax);
+		mov(DRC_R(rd), eax);
+	} else {
+		mov(edx, DRC_R(rd));
+		Store(nSize);
+	}
+}
+
+// After a load or store: leave if it wrote into the block, and the way for the accesses that go to
+// the handlers, which are run by the interpreter
+void Arm7Drc::Slow(Xbyak::Label& lSlow, bool bStore)
+{
+	Xbyak::Label lDone;
+
+	if (bStore) {
+		cmp(DRC_LEAVE, 0);
+		je(lDone, T_NEAR);
+		mov(DRC_PC, m_nAddr + m_nSize);
+		Pending(m_nPend + m_nCur);
+		jmp(*m_pLeave, T_NEAR);
+	} else {
+		jmp(lDone, T_NEAR);
+	}
+
+	L(lSlow);
+	Step(m_nCycles + m_nCur);
+	add(DRC_ICOUNT, m_nCur);	// as Done() takes them off again
+
+	L(lDone);
+}
+
+// Jump to lSkip if the condition fails
+void Arm7Drc::Condition(UINT32 nCond, Xbyak::Label& lSkip)
+{
+	mov(eax, DRC_CPSR);
+
+	switch (nCond) {
+		case COND_EQ: test(eax, Z_MASK); jz(lSkip, T_NEAR); break;
+		case COND_NE: test(eax, Z_MASK); jnz(lSkip, T_NEAR); break;
+		case COND_CS: test(eax, C_MASK); jz(lSkip, T_NEAR); break;
+		case COND_CC: test(eax, C_MASK); jnz(lSkip, T_NEAR); break;
+		case COND_MI: test(eax, N_MASK); jz(lSkip, T_NEAR); break;
+		case COND_PL: test(eax, N_MASK); jnz(lSkip, T_NEAR); break;
+		case COND_VS: test(eax, V_MASK); jz(lSkip, T_NEAR); break;
+		case COND_VC: test(eax, V_MASK); jnz(lSkip, T_NEAR); break;
+
+		case COND_HI:
+			and_(eax, C_MASK | Z_MASK);
+			cmp(eax, C_MASK);
+			jne(lSkip, T_NEAR);
+			break;
+
+		case COND_LS:
+			and_(eax, C_MASK | Z_MASK);
+			cmp(eax, C_MASK);
+			je(lSkip, T_NEAR);
+			break;
+
+		// N != V in bit 31 of ecx
+		case COND_GE:
+		case COND_LT:
+		case COND_GT:
+		case COND_LE:
+			mov(ecx, eax);
+			shl(ecx, N_BIT - V_BIT);
+			xor_(ecx, eax);
+			if (nCond == COND_GE) js(lSkip, T_NEAR);
+			if (nCond == COND_LT) jns(lSkip, T_NEAR);
+			if (nCond == COND_GT) {
+				js(lSkip, T_NEAR);
+				test(eax, Z_MASK);
+				jnz(lSkip, T_NEAR);
+			}
+			if (nCond == COND_LE) {
+				and_(ecx, N_MASK);
+				and_(eax, Z_MASK);
+				or_(ecx, eax);
+				jz(lSkip, T_NEAR);
+			}
+			break;
+	}
+}
+
+// Register n as the interpreter reads it, with the pc reading as nPc
+void Arm7Drc::LoadReg(const Xbyak::Reg32& r, INT32 n, UINT32 nPc)
+{
+	if (n == 15) {
+		mov(r, nPc);
+	} else {
+		mov(r, DRC_R(n));
+	}
+}
+
+// N and Z from the result in eax, the other flags in nMask are cleared and or'ed in from ecx
+void Arm7Drc::StoreNZ(UINT32 nMask)
+{
+	test(eax, eax);
+	sets(r9b);
+	setz(r10b);
+	mov(edx, DRC_CPSR);
+	and_(edx, ~(N_MASK | Z_MASK | nMask));
+	if (nMask) or_(edx, ecx);
+	movzx(r9d, r9b);
+	shl(r9d, N_BIT);
+	or_(edx, r9d);
+	movzx(r10d, r10b);
+	shl(r10d, Z_BIT);
+	or_(edx, r10d);
+	mov(DRC_CPSR, edx);
+}
+
+// N and Z from eax, C from r8b
+void Arm7Drc::StoreNZC()
+{
+	movzx(ecx, r8b);
+	shl(ecx, C_BIT);
+	StoreNZ(C_MASK);
+}
+
+// NZCV from the x86 flags of an add or subtract, the carry is the inverse of the borrow
+void Arm7Drc::StoreNZCV(bool bSub)
+{
+	if (bSub) setnc(r8b); else setc(r8b);
+	seto(r11b);
+	movzx(ecx, r8b);
+	shl(ecx, C_BIT);
+	movzx(r11d, r11b);
+	shl(r11d, V_BIT);
+	or_(ecx, r11d);
+	StoreNZ(C_MASK | V_MASK);
+}
+
+// eax + edx + C into eax, setting the flags.  The carry out is worked out without the carry in,
+// as HandleALUAddFlags() does.
+void Arm7Drc::StoreAdc()
+{
+	mov(ecx, eax);
+	not_(ecx);
+	cmp(ecx, edx);
+	setb(r8b);
+	bt(DRC_CPSR, C_BIT);
+	adc(eax, edx);
+	seto(r11b);
+	movzx(ecx, r8b);
+	shl(ecx, C_BIT);
+	movzx(r11d, r11b);
+	shl(r11d, V_BIT);
+	or_(ecx, r11d);
+	StoreNZ(C_MASK | V_MASK);
+}
+
+// ARM instructions -----------------------------------------------------------
+
+// The shifter operand into edx, as decodeShift() works it out, returns where the carry out is
+INT32 Arm7Drc::Operand2(UINT32 insn, bool bCarry)
+{
+	if (insn & INSN_I) {
+		UINT32 by = (insn & INSN_OP2_ROTATE) >> INSN_OP2_ROTATE_SHIFT;
+		UINT32 op2 = insn & INSN_OP2_IMM;
+
+		if (by) {
+			op2 = ROR(op2, by << 1);
+		}
+		mov(edx, op2);
+
+		if (by == 0) return DRC_CARRY_KEEP;
+		return (op2 & SIGN_BIT) ? DRC_CARRY_1 : DRC_CARRY_0;
+	}
+
+	UINT32 k = (insn & INSN_OP2_SHIFT) >> INSN_OP2_SHIFT_SHIFT;
+	UINT32 t = (insn & INSN_OP2_SHIFT_TYPE) >> INSN_OP2_SHIFT_TYPE_SHIFT;
+
+	LoadReg(edx, insn & INSN_OP2_RM, m_nAddr + 8);
+
+	switch (t >> 1) {
+		case 0:		// LSL
+			if (k == 0) return DRC_CARRY_KEEP;
+			if (bCarry) { bt(edx, 32 - k); setc(r8b); }
+			shl(edx, k);
+			break;
+
+		case 1:		// LSR, 0 is 32
+			if (bCarry) { bt(edx, k ? k - 1 : 31); setc(r8b); }
+			if (k) shr(edx, k); else xor_(edx, edx);
+			break;
+
+		case 2:		// ASR, 0 is 32
+			if (bCarry) { bt(edx, k ? k - 1 : 31); setc(r8b); }
+			sar(edx, k ? k : 31);
+			break;
+
+		case 3:		// ROR, 0 is RRX
+			if (bCarry) { bt(edx, k ? k - 1 : 0); setc(r8b); }
+			if (k) {
+				ror(edx, k);
+			} else {
+				mov(ecx, DRC_CPSR);
+				and_(ecx, C_MASK);
+				shl(ecx, N_BIT - C_BIT);
+				shr(edx, 1);
+				or_(edx, ecx);
+			}
+			break;
+	}
+
+	return DRC_CARRY_R8;
+}
+
+// HandleALU(), without R15 as the destination or shifts by a register
+void Arm7Drc::Alu(UINT32 insn)
+{
+	UINT32 nOp = (insn & INSN_OPCODE) >> INSN_OPCODE_SHIFT;
+	UINT32 rd = (insn & INSN_RD) >> INSN_RD_SHIFT;
+	UINT32 rn = (insn & INSN_RN) >> INSN_RN_SHIFT;
+	bool bS = (insn & INSN_S) != 0;
+	bool bLogical = (nOp & 6) == 0 || (nOp & 0xc) == 0xc;
+
+	INT32 nCarry = Operand2(insn, bS && bLogical);
+
+	if ((nOp & 0xd) != 0xd) {	// no Rn in MOV and MVN
+		LoadReg(eax, rn, m_nAddr + 8);
+	}
+
+	switch (nOp) {
+		case OPCODE_AND:
+		case OPCODE_TST: and_(eax, edx); break;
+		case OPCODE_EOR:
+		case OPCODE_TEQ: xor_(eax, edx); break;
+		case OPCODE_ORR: or_(eax, edx); break;
+		case OPCODE_MOV: mov(eax, edx); break;
+		case OPCODE_BIC: not_(edx); and_(eax, edx); break;
+		case OPCODE_MVN: mov(eax, edx); not_(eax); break;
+
+		case OPCODE_SUB:
+		case OPCODE_CMP:
+			sub(eax, edx);
+			if (bS) StoreNZCV(true);
+			break;
+
+		case OPCODE_RSB:
+			sub(edx, eax);
+			mov(eax, edx);
+			if (bS) StoreNZCV(true);
+			break;
+
+		case OPCODE_ADD:
+		case OPCODE_CMN:
+			add(eax, edx);
+			if (bS) StoreNZCV(false);
+			break;
+
+		case OPCODE_ADC:
+			if (bS) {
+				StoreAdc();
+			} else {
+				bt(DRC_CPSR, C_BIT);
+				adc(eax, edx);
+			}
+			break;
+
+		case OPCODE_SBC:
+			bt(DRC_CPSR, C_BIT);
+			cmc();
+			sbb(eax, edx);
+			if (bS) StoreNZCV(true);
+			break;
+
+		case OPCODE_RSC:
+			bt(DRC_CPSR, C_BIT);
+			cmc();
+			sbb(edx, eax);
+			mov(eax, edx);
+			if (bS) StoreNZCV(true);
+			break;
+	}
+
+	if (bS && bLogical) {
+		switch (nCarry) {
+			case DRC_CARRY_KEEP:
+				StoreNZ(0);
+				break;
+
+			case DRC_CARRY_0:
+			case DRC_CARRY_1:
+				mov(ecx, (nCarry == DRC_CARRY_1) ? C_MASK : 0);
+				StoreNZ(C_MASK);
+				break;
+
+			case DRC_CARRY_R8:
+				StoreNZC();
+				break;
+		}
+	}
+
+	if ((nOp & 0xc) != 0x8) {	// not TST TEQ CMP CMN
+		mov(DRC_R(rd), eax);
+	}
+}
+
+// HandleMemSingle(), without R15 loaded or written back
+void Arm7Drc::MemSingle(UINT32 insn, Xbyak::Label& lSlow)
+{
+	UINT32 rn = (insn & INSN_RN) >> INSN_RN_SHIFT;
+	UINT32 rd = (insn & INSN_RD) >> INSN_RD_SHIFT;
+	bool bLoad = (insn & INSN_SDT_L) != 0;
+	INT32 nSize = (insn & INSN_SDT_B) ? 1 : 4;
+
+	// Offset in edx, address in ecx
+	if (insn & INSN_I) {
+		Operand2(insn & ~INSN_I, false);
+	} else {
+		mov(edx, insn & INSN_SDT_IMM);
+	}
+
+	LoadReg(ecx, rn, m_nAddr + 8);
+	if (insn & INSN_SDT_P) {
+		if (insn & INSN_SDT_U) add(ecx, edx); else sub(ecx, edx);
+	}
+
+	Page(bLoad ? r12 : r13, lSlow);
+
+	// Written back before the access, the post-indexed one is lost if it's the register loaded
+	if (insn & INSN_SDT_P) {
+		if (insn & INSN_SDT_W) mov(DRC_R(rn), ecx);
+	} else if (rd != rn) {
+		mov(eax, ecx);
+		if (insn & INSN_SDT_U) add(eax, edx); else sub(eax, edx);
+		mov(DRC_R(rn), eax);
+	}
+
+	if (!bLoad && rd == 15) {
+		mov(edx, (nSize == 1) ? (m_nAddr & 0xff) : (m_nAddr + 12));
+		Store(nSize);
+	} else {
+		Transfer(bLoad, nSize, 0, rd);
+	}
+}
+
+// HandleHalfWordDT(), without R15 anywhere
+void Arm7Drc::MemHalf(UINT32 insn, Xbyak::Label& lSlow)
+{
+	UINT32 rn = (insn & INSN_RN) >> INSN_RN_SHIFT;
+	UINT32 rd = (insn & INSN_RD) >> INSN_RD_SHIFT;
+	bool bLoad = (insn & INSN_SDT_L) != 0;
+
+	if (insn & 0x400000) {
+		mov(edx, ((insn >> 4) & 0xf0) | (insn & 0x0f));
+	} else {
+		mov(edx, DRC_R(insn & 0x0f));
+	}
+
+	mov(ecx, DRC_R(rn));
+	if (insn & INSN_SDT_P) {
+		if (insn & INSN_SDT_U) add(ecx, edx); else sub(ecx, edx);
+	}
+
+	Page(bLoad ? r12 : r13, lSlow);
+
+	if (insn & INSN_SDT_P) {
+		if (insn & INSN_SDT_W) mov(DRC_R(rn), ecx);
+	} else if (rd != rn) {
+		mov(eax, ecx);
+		if (insn & INSN_SDT_U) add(eax, edx); else sub(eax, edx);
+		mov(DRC_R(rn), eax);
+	}
+
+	// LDRSB, LDRSH and LDRH, all the stores are STRH
+	Transfer(bLoad, (bLoad && (insn & 0x60) == 0x40) ? 1 : 2, (insn & 0x40) ? 1 : 0, rd);
+}
+
+// HandleMul(), without R15 anywhere
+void Arm7Drc::Mul(UINT32 insn)
+{
+	mov(eax, DRC_R(insn & INSN_MUL_RM));
+	imul(eax, DRC_R((insn & INSN_MUL_RS) >> INSN_MUL_RS_SHIFT));
+
+	if (insn & INSN_MUL_A) {
+		add(eax, DRC_R((insn & INSN_MUL_RN) >> INSN_MUL_RN_SHIFT));
+	}
+
+	mov(DRC_R((insn & INSN_MUL_RD) >> INSN_MUL_RD_SHIFT), eax);
+
+	if (insn & INSN_S) {
+		StoreNZ(0);
+	}
+}
+
+INT32 Arm7Drc::CompileArm(UINT32 nAddr)
+{
+	UINT32 insn = ReadArm(nAddr);
+	UINT32 nCond = insn >> INSN_COND_SHIFT;
+	UINT32 rn = (insn & INSN_RN) >> INSN_RN_SHIFT;
+	UINT32 rd = (insn & INSN_RD) >> INSN_RD_SHIFT;
+	INT32 nType = 0;
+
+	enum { ARM_ALU = 1, ARM_MEM, ARM_HALF, ARM_MUL, ARM_B, ARM_BX };
+
+	// Never run, 1 cycle
+	if (nCond == COND_NV) {
+		Done(1);
+		return DRC_NEXT;
+	}
+
+	// Decoded as arm7exec.c does
+	switch ((insn & 0xf000000) >> 24) {
+		case 0x0:
+		case 0x1:
+		case 0x2:
+		case 0x3:
+			if ((insn & 0x0ffffff0) == 0x012fff10) {
+				nType = ARM_BX;
+			}
+			else if ((insn & 0x0e000000) == 0 && (insn & 0x80) && (insn & 0x10)) {
+				if (insn & 0x60) {
+					if (rn != 15 && rd != 15 && ((insn & 0x400000) || (insn & 0x0f) != 15)) nType = ARM_HALF;
+				}
+				else if ((insn & 0x01800000) == 0) {
+					if ((insn & 0x0f) != 15 && ((insn >> 8) & 0x0f) != 15 && rn != 15 && rd != 15) nType = ARM_MUL;
+				}
+			}
+			else if ((insn & INSN_S) == 0 && (insn & 0x01800000) == 0x01000000) {
+				// PSR transfer
+			}
+			else if (rd != 15 && ((insn & INSN_I) || (insn & 0x10) == 0)) {
+				nType = ARM_ALU;
+			}
+			break;
+
+		case 0x4:
+		case 0x5:
+		case 0x6:
+		case 0x7:
+			if ((insn & INSN_SDT_L) && rd == 15) break;
+			if (rn == 15 && (!(insn & INSN_SDT_P) || (insn & INSN_SDT_W))) break;
+			if ((insn & INSN_I) && (insn & 0x10)) break;	// a shift by a register
+			nType = ARM_MEM;
+			break;
+
+		case 0xa:
+		case 0xb:
+			nType = ARM_B;
+			break;
+	}
+
+	if (nType == 0) {
+		return Fallback();
+	}
+
+	Xbyak::Label lSkip, lSlow, lDone;
+	bool bCond = (nCond != COND_AL);
+
+	if (nType == ARM_B || nType == ARM_BX) {
+		if (bCond) Condition(nCond, lSkip);
+
+		if (nType == ARM_B) {
+			UINT32 off = (insn & INSN_BRANCH) << 2;
+			if (off & 0x2000000) off |= 0xfc000000;
+
+			if (insn & INSN_BL) {
+				mov(DRC_R(14), nAddr + 4);
+			}
+			EndBlock(nAddr + 8 + off, 3);
+		} else {
+			// Odd addresses switch to Thumb
+			Xbyak::Label lArm;
+
+			LoadReg(eax, insn & 0x0f, nAddr);
+			test(al, 1);
+			jz(lArm);
+			or_(DRC_CPSR, T_MASK);
+			dec(eax);
+			L(lArm);
+			mov(DRC_PC, eax);
+			Pending(m_nPend + 3);
+			xor_(eax, eax);
+			Epilog();
+		}
+
+		if (bCond) {
+			L(lSkip);
+			EndBlock(nAddr + 4, 1);
+		}
+
+		Done(3);
+		return DRC_END;
+	}
+
+	bool bMem = (nType == ARM_MEM || nType == ARM_HALF);
+
+	m_nCur = (bMem && !(insn & INSN_SDT_L)) ? 2 : 3;
+
+	// The interpreter takes its own cycles off for accesses to the handlers
+	if (bMem) TakePending();
+
+	if (bCond) Condition(nCond, lSkip);
+
+	switch (nType) {
+		case ARM_ALU: Alu(insn); break;
+		case ARM_MEM: MemSingle(insn, lSlow); break;
+		case ARM_HALF: MemHalf(insn, lSlow); break;
+		case ARM_MUL: Mul(insn); break;
+	}
+
+	if (bMem) Slow(lSlow, !(insn & INSN_SDT_L));
+
+	if (bCond) {
+		jmp(lDone, T_NEAR);
+		L(lSkip);
+		add(DRC_ICOUNT, m_nCur - 1);
+		L(lDone);
+	}
+
+	Done(m_nCur);
+
+	return DRC_NEXT;
+}
+
+// Thumb instructions ---------------------------------------------------------
+
+INT32 Arm7Drc::CompileThumb(UINT32 nAddr)
+{
+	UINT32 insn = ReadThumb(nAddr);
+	UINT32 rd = insn & 7;
+	UINT32 rs = (insn >> 3) & 7;
+	UINT32 rn = (insn >> 6) & 7;
+	UINT32 offs = (insn & THUMB_SHIFT_AMT) >> THUMB_SHIFT_AMT_SHIFT;
+
+	m_nCur = (3 - thumbCycles[insn >> 8]) + 3;
+
+	switch ((insn & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT) {
+		case 0x0:	// LSL LSR Rd, Rs, #offs
+			mov(eax, DRC_R(rs));
+			if (insn & THUMB_SHIFT_R) {
+				bt(eax, offs ? offs - 1 : 31);
+				setc(r8b);
+				if (offs) shr(eax, offs); else xor_(eax, eax);
+				StoreNZC();
+			} else if (offs) {
+				bt(eax, 32 - offs);
+				setc(r8b);
+				shl(eax, offs);
+				StoreNZC();
+			} else {
+				StoreNZ(0);
+			}
+			mov(DRC_R(rd), eax);
+			break;
+
+		case 0x1:
+			mov(eax, DRC_R(rs));
+			if (insn & THUMB_INSN_ADDSUB) {		// ADD SUB Rd, Rs, Rn or #imm
+				if (insn & 0x400) {
+					mov(edx, rn);
+				} else {
+					mov(edx, DRC_R(rn));
+				}
+				if (insn & 0x200) sub(eax, edx); else add(eax, edx);
+				StoreNZCV((insn & 0x200) != 0);
+			} else {							// ASR Rd, Rs, #offs, 0 is 32
+				bt(eax, offs ? offs - 1 : 31);
+				setc(r8b);
+				sar(eax, offs ? offs : 31);
+				StoreNZC();
+			}
+			mov(DRC_R(rd), eax);
+			break;
+
+		case 0x2:	// MOV CMP Rd, #imm
+		case 0x3:	// ADD SUB Rd, #imm
+			rd = (insn & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT;
+			switch ((insn >> 11) & 3) {
+				case 0:
+					mov(eax, insn & THUMB_INSN_IMM);
+					StoreNZ(0);
+					break;
+				case 1:
+				case 3:
+					mov(eax, DRC_R(rd));
+					sub(eax, insn & THUMB_INSN_IMM);
+					StoreNZCV(true);
+					break;
+				case 2:
+					mov(eax, DRC_R(rd));
+					add(eax, insn & THUMB_INSN_IMM);
+					StoreNZCV(false);
+					break;
+			}
+			if (((insn >> 11) & 3) != 1) {
+				mov(DRC_R(rd), eax);
+			}
+			break;
+
+		case 0x4:
+			if ((insn & THUMB_GROUP4_TYPE) == 0) {
+				UINT32 nOp = (insn & THUMB_ALUOP_TYPE) >> THUMB_ALUOP_TYPE_SHIFT;
+
+				// The shifts by a register are left to the interpreter
+				if ((nOp >= 0x2 && nOp <= 0x4) || nOp == 0x7) {
+					return Fallback();
+				}
+
+				mov(eax, DRC_R(rd));
+				mov(edx, DRC_R(rs));
+				switch (nOp) {
+					case 0x0: and_(eax, edx); StoreNZ(0); break;						// AND
+					case 0x1: xor_(eax, edx); StoreNZ(0); break;						// EOR
+					case 0x5: StoreAdc(); break;										// ADC
+					case 0x6: bt(DRC_CPSR, C_BIT); cmc(); sbb(eax, edx); StoreNZCV(true); break;	// SBC
+					case 0x8: and_(eax, edx); StoreNZ(0); break;						// TST
+					case 0x9: xor_(eax, eax); sub(eax, edx); StoreNZCV(true); break;	// NEG
+					case 0xa: sub(eax, edx); StoreNZCV(true); break;					// CMP
+					case 0xb: add(eax, edx); StoreNZCV(false); break;					// CMN
+					case 0xc: or_(eax, edx); StoreNZ(0); break;							// ORR
+					case 0xd: imul(eax, edx); StoreNZ(0); break;						// MUL
+					case 0xe: not_(edx); and_(eax, edx); StoreNZ(0); break;				// BIC
+					case 0xf: mov(eax, edx); not_(eax); StoreNZ(0); break;				// MVN
+				}
+				if (nOp != 0x8 && nOp != 0xa && nOp != 0xb) {
+					mov(DRC_R(rd), eax);
+				}
+				break;
+			}
+
+			if ((insn & THUMB_GROUP4_TYPE) == 0x400) {
+				UINT32 nOp = (insn & THUMB_HIREG_OP) >> THUMB_HIREG_OP_SHIFT;
+				UINT32 nH = (insn & THUMB_HIREG_H) >> THUMB_HIREG_H_SHIFT;
+				UINT32 hd = rd + ((nH & 2) ? 8 : 0);
+				UINT32 hs = rs + ((nH & 1) ? 8 : 0);
+
+				// Reads of the pc add the prefetch, writes to it branch
+				if (hd == 15 || hs == 15) {
+					return Fallback();
+				}
+
+				if (nOp == 0x3) {				// BX Rs, to ARM if it's even
+					Xbyak::Label lArm, lSet;
+
+					if (nH & 2) {
+						return Fallback();
+					}
+
+					mov(eax, DRC_R(hs));
+					test(al, 1);
+					jz(lArm);
+					and_(eax, ~1);
+					jmp(lSet);
+					L(lArm);
+					and_(DRC_CPSR, ~T_MASK);
+					test(al, 2);
+					jz(lSet);
+					add(eax, 2);
+					L(lSet);
+					mov(DRC_PC, eax);
+					Pending(m_nPend + m_nCur);
+					xor_(eax, eax);
+					Epilog();
+
+					Done(m_nCur);
+					return DRC_END;
+				}
+
+				if (nH == 0 && nOp != 0x1) {
+					return Fallback();
+				}
+
+				mov(edx, DRC_R(hs));
+				switch (nOp) {
+					case 0x0: add(DRC_R(hd), edx); break;		// ADD
+					case 0x1:									// CMP
+						mov(eax, DRC_R(hd));
+						sub(eax, edx);
+						StoreNZCV(true);
+						break;
+					case 0x2: mov(DRC_R(hd), edx); break;		// MOV
+				}
+				break;
+			}
+
+			// LDR Rd, [PC, #imm]
+			rd = (insn & THUMB_INSN_IMM_RD) >> THUMB_INSN_IMM_RD_SHIFT;
+			mov(ecx, (nAddr & ~2) + 4 + ((insn & THUMB_INSN_IMM) << 2));
+			goto load_store;
+
+		case 0x5:	// LDR STR Rd, [Rn, Rm]
+			mov(ecx, DRC_R(rs));
+			add(ecx, DRC_R(rn));
+			goto load_store;
+
+		case 0x6:	// LDR STR Rd, [Rn, #imm]
+			mov(ecx, DRC_R(rs));
+			add(ecx, offs << 2);
+			goto load_store;
+
+		case 0x7:	// LDRB STRB Rd, [Rn, #imm]
+			mov(ecx, DRC_R(rs));
+			add(ecx, offs);
+			goto load_store;
+
+		case 0x8:	// LDRH STRH Rd, [Rn, #imm]
+			mov(ecx, DRC_R(rs));
+			add(ecx, offs << 1);
+			goto load_store;
+
+		case 0x9:	// LDR STR Rd, [SP, #imm]
+			rd = (insn & THUMB_STACKOP_RD) >> THUMB_STACKOP_RD_SHIFT;
+			mov(ecx, DRC_R(13));
+			add(ecx, (insn & THUMB_INSN_IMM) << 2);
+			goto load_store;
+
+		case 0xa:	// ADD Rd, SP or PC, #imm
+			rd = (insn & THUMB_RELADDR_RD) >> THUMB_RELADDR_RD_SHIFT;
+			if (insn & THUMB_RELADDR_SP) {
+				mov(eax, DRC_R(13));
+				add(eax, (insn & THUMB_INSN_IMM) << 2);
+			} else {
+				mov(eax, ((nAddr + 4) & ~2) + ((insn & THUMB_INSN_IMM) << 2));
+			}
+			mov(DRC_R(rd), eax);
+			break;
+
+		case 0xb:	// ADD SP, #imm, the pushes and pops are left to the interpreter
+			if ((insn & THUMB_STACKOP_TYPE) != 0) {
+				return Fallback();
+			}
+			if (insn & THUMB_INSN_IMM_S) {
+				sub(DRC_R(13), (insn & 0x7f) << 2);
+			} else {
+				add(DRC_R(13), (insn & 0x7f) << 2);
+			}
+			break;
+
+		case 0xd: {	// Bcc
+			UINT32 nCond = (insn & THUMB_COND_TYPE) >> THUMB_COND_TYPE_SHIFT;
+			Xbyak::Label lSkip;
+
+			if (nCond >= COND_AL) {
+				return Fallback();
+			}
+
+			Condition(nCond, lSkip);
+			EndBlock(nAddr + 4 + ((INT32)(INT8)(insn & THUMB_INSN_IMM) << 1), m_nCur);
+			L(lSkip);
+			EndBlock(nAddr + 2, m_nCur);
+
+			Done(m_nCur);
+			return DRC_END;
+		}
+
+		case 0xe: {	// B
+			UINT32 off = (insn & THUMB_BRANCH_OFFS) << 1;
+
+			if (insn & THUMB_BLOP_LO) {
+				return Fallback();
+			}
+			if (off & 0x800) off |= 0xfffff800;
+
+			EndBlock(nAddr + 4 + off, m_nCur);
+
+			Done(m_nCur);
+			return DRC_END;
+		}
+
+		case 0xf:	// BL, in two halves
+			if (insn & THUMB_BLOP_LO) {
+				mov(eax, DRC_R(14));
+				add(eax, (insn & THUMB_BLOP_OFFS) << 1);
+				mov(DRC_R(14), (nAddr + 2) | 1);
+				mov(DRC_PC, eax);
+				Pending(m_nPend + m_nCur);
+				xor_(eax, eax);
+				Epilog();
+
+				Done(m_nCur);
+				return DRC_END;
+			} else {
+				UINT32 addr = (insn & THUMB_BLOP_OFFS) << 12;
+				if (addr & (1 << 22)) addr |= 0xff800000;
+
+				mov(DRC_R(14), addr + nAddr + 4);
+			}
+			break;
+
+		default:	// LDMIA STMIA
+			return Fallback();
+	}
+
+	Done(m_nCur);
+	return DRC_NEXT;
+
+load_store:
+	{
+		// The address is in ecx
+		static const INT8 nGroup5Size[8] = { 4, 2, 1, 1, 4, 2, 1, 2 };
+		UINT32 nType = (insn & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT;
+		INT32 nSize = 4, nSign = 0;
+		bool bLoad = (nType == 0x4) || (insn & 0x800);
+		Xbyak::Label lSlow;
+
+		if (nType == 0x5) {
+			UINT32 nOp = (insn & THUMB_GROUP5_TYPE) >> THUMB_GROUP5_TYPE_SHIFT;
+			nSize = nGroup5Size[nOp];
+			nSign = (nOp == 0x3 || nOp == 0x7);
+			bLoad = (nOp >= 0x3);
+		}
+		if (nType == 0x7) nSize = 1;
+		if (nType == 0x8) nSize = 2;
+
+		// The interpreter takes its own cycles off for accesses to the handlers
+		TakePending();
+
+		Page(bLoad ? r12 : r13, lSlow);
+		Transfer(bLoad, nSize, nSign, rd);
+		Slow(lSlow, !bLoad);
+	}
+
+	Done(m_nCur);
+	return DRC_NEXT;
+}
+
+#undef DRC_ARG1
+#undef DRC_ARG2
+
+// The dispatcher -------------------------------------------------------------
+
+void arm7_drc_exit()
+{
+	delete arm7_drc;
+	arm7_drc = NULL;
+}
+
+static int Arm7RunDrc(int cycles)
+{
+	if (arm7_drc == NULL) {
+		arm7_drc = new Arm7Drc();
+	}
+
+	ARM7_ICOUNT = cycles;
+	curr_cycles = cycles;
+	end_run = 0;
+
+	do
+	{
+		// A waiting exception is taken after the next instruction, so that one is stepped
+		Arm7DrcBlock* pBlock = arm7_drc_irq_ready() ? NULL : arm7_drc->GetBlock(R15, GET_CPSR & (T_MASK | MODE_FLAG));
+
+		if (pBlock && pBlock->pCode && ARM7_ICOUNT > pBlock->nCycles) {
+			arm7_drc_leave = 0;
+			if (((INT32 (*)())pBlock->pCode)()) {
+				arm7_drc->Drop(R15, pBlock);
+			}
+		} else {
+			arm7_execute();
+		}
+	} while (ARM7_ICOUNT > 0 && !end_run);
+
+	cycles = curr_cycles - ARM7_ICOUNT;
+	total_cycles += cycles;
+	curr_cycles = ARM7_ICOUNT = 0;
+
+	return cycles;
+}
@@ -29,9 +29,9 @@
  *         It has been split into it's own file (from the arm7core.c) so it can be
  *         directly compiled into any cpu core that wishes to use it.
  *
- *         It should be included as follows in your cpu core:
+ *         It runs one instruction, and should be included as follows in your cpu core:
  *
- *         int arm7_execute(int cycles)
+ *         static void arm7_execute()
  *         {
  *         #include "arm7exec.c"
  *         }
@@ -44,11 +44,6 @@
     UINT32 pc;
     UINT32 insn;
 
-    ARM7_ICOUNT = cycles;
-    curr_cycles = cycles;
-	end_run = 0;
-
-    do
     {
         /* handle Thumb instructions if active */
         if (T_IS_SET(GET_CPSR))
@@ -1360,11 +1355,5 @@
 
         /* All instructions remove 3 cycles.. Others taking less / more will have adjusted this # prior to here */
         ARM7_ICOUNT -= 3;
-    } while (ARM7_ICOUNT > 0 && !end_run);
-
-	cycles = curr_cycles - ARM7_ICOUNT;
-	total_cycles += cycles;
-	curr_cycles = ARM7_ICOUNT = 0;
-
-    return cycles;
+    }
 }
@@ -28,6 +28,21 @@ static UINT8  (*pReadByteHandler)(UINT32) = NULL;
 
 static UINT32 Arm7IdleLoop = ~0;
 
+#ifdef ARM7_X64_DRC
+// for the recompiler in arm7_x64.h
+UINT8** arm7_drc_membase(INT32 nType)
+{
+	return membase[nType];
+}
+
+UINT32 arm7_drc_idle_loop()
+{
+	return Arm7IdleLoop;
+}
+
+extern void arm7_drc_exit();
+#endif
+
 extern void arm7_set_irq_line(INT32 irqline, INT32 state);
 
 static void core_set_irq(INT32 /*cpu*/, INT32 irqline, INT32 state)
@@ -73,6 +88,10 @@ void Arm7Exit() // only one cpu supported
 	}
 
 	Arm7IdleLoop = ~0;
+
+#ifdef ARM7_X64_DRC
+	arm7_drc_exit();
+#endif
 	
 	DebugCPU_ARM7Initted = 0;
 }
@@ -402,5 +421,7 @@ void Arm7Init( INT32 nCPU ) // only one cpu supported
 		memset(membase[i], 0, PAGE_COUNT * sizeof(UINT8*));
 	}
 
+	Arm7UseRecompiler(false);
+
 	CpuCheatRegister(nCPU, &Arm7Config);
 }
@@ -25,6 +25,8 @@ void Arm7Close();
 
 INT32 Arm7Scan(INT32 nAction);
 
+INT32 Arm7UseRecompiler(bool use); // x86-64 builds with ARM7_X64_DRC, call after Arm7Init()
+
 #define ARM7_IRQ_LINE		0
 #define ARM7_FIRQ_LINE		1
 
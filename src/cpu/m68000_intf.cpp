@@ -60,7 +60,8 @@ cpu_core_config SekConfig =
 	SekRunEnd,
 	SekReset,
 	0x1000000,
-	0
+	0,
+	SekRunEndSync
 };
 
 #if defined (FBNEO_DEBUG)
@@ -694,14 +695,50 @@ UINT32 __fastcall M68KFetchByte(UINT32 a) { return (UINT32)FetchByte(a); }
 UINT32 __fastcall M68KFetchWord(UINT32 a) { return (UINT32)FetchWord(a); }
 UINT32 __fastcall M68KFetchLong(UINT32 a) { return               FetchLong(a); }
 
+// Fetch page cache for Musashi's prefetch (m68k_read_immediate_16 in m68kconf.h).
+// todo: this only takes the memory map lookup out of the opcode fetch.  64-bit builds still
+// lack a fast 68000: Musashi keeps dispatching through the 64K handler table, and there's
+// no recompiler or threaded-code (computed goto, lazy flags) variant yet.
+#if SEK_SHIFT != M68K_FETCH_PAGE_SHIFT
+ #error M68K_FETCH_PAGE_SHIFT in m68kconf.h must match SEK_SHIFT
+#endif
+
+UINT8* M68KFetchMemory = NULL;
+UINT32 M68KFetchPage = ~0U;
+
+// As FetchWord(), remembering the page for M68KFetchWordCached() if it's memory
+UINT32 __fastcall M68KFetchWordPage(UINT32 a)
+{
+	UINT8* pr;
+
+	a &= 0xFFFFFF;
+
+	pr = FIND_F(a);
+	if ((uintptr_t)pr >= SEK_MAXHANDLER) {
+		M68KFetchPage = a >> SEK_SHIFT;
+		M68KFetchMemory = pr - (a & ~SEK_PAGEM);
+		return BURN_ENDIAN_SWAP_INT16(*((UINT16*)(pr + (a & SEK_PAGEM))));
+	}
+
+	return pSekExt->ReadWord[(uintptr_t)pr](a);
+}
+
+UINT32 M68KIdleLoopSize = 0;
+static UINT32 nM68KWrites = 0;						// Any write makes a loop not idle
+
+int M68KIdleCheck(unsigned int pc, const void* state, int size)
+{
+	return BurnIdleCheck(&pSekExt->Idle, _T("68000"), nSekActive, pc, nM68KWrites, state, size);
+}
+
 #ifdef FBNEO_DEBUG
 UINT32 __fastcall M68KReadByteBP(UINT32 a) { return (UINT32)ReadByteBP(a); }
 UINT32 __fastcall M68KReadWordBP(UINT32 a) { return (UINT32)ReadWordBP(a); }
 UINT32 __fastcall M68KReadLongBP(UINT32 a) { return               ReadLongBP(a); }
 
-void __fastcall M68KWriteByteBP(UINT32 a, UINT32 d) { WriteByteBP(a, d); }
-void __fastcall M68KWriteWordBP(UINT32 a, UINT32 d) { WriteWordBP(a, d); }
-void __fastcall M68KWriteLongBP(UINT32 a, UINT32 d) { WriteLongBP(a, d); }
+void __fastcall M68KWriteByteBP(UINT32 a, UINT32 d) { nM68KWrites++; WriteByteBP(a, d); }
+void __fastcall M68KWriteWordBP(UINT32 a, UINT32 d) { nM68KWrites++; WriteWordBP(a, d); }
+void __fastcall M68KWriteLongBP(UINT32 a, UINT32 d) { nM68KWrites++; WriteLongBP(a, d); }
 
 void M68KCheckBreakpoint(unsigned int pc) { CheckBreakpoint_PC(pc); }
 void M68KSingleStep(unsigned int pc) { SingleStep_PC(pc); }
@@ -715,12 +752,20 @@ void (__fastcall *M68KWriteWordDebug)(UINT32, UINT32);
 void (__fastcall *M68KWriteLongDebug)(UINT32, UINT32);
 #endif
 
-void __fastcall M68KWriteByte(UINT32 a, UINT32 d) { WriteByte(a, d); }
-void __fastcall M68KWriteWord(UINT32 a, UINT32 d) { WriteWord(a, d); }
-void __fastcall M68KWriteLong(UINT32 a, UINT32 d) { WriteLong(a, d); }
+void __fastcall M68KWriteByte(UINT32 a, UINT32 d) { nM68KWrites++; WriteByte(a, d); }
+void __fastcall M68KWriteWord(UINT32 a, UINT32 d) { nM68KWrites++; WriteWord(a, d); }
+void __fastcall M68KWriteLong(UINT32 a, UINT32 d) { nM68KWrites++; WriteLong(a, d); }
 }
 #endif
 
+// Forget the page Musashi last fetched from (the memory map or the open cpu has changed)
+static inline void SekFlushFetchPage()
+{
+#ifdef EMU_M68K
+	M68KFetchPage = ~0U;
+#endif
+}
+
 #if defined EMU_A68K
 struct A68KInter a68k_inter_normal = {
 	NULL,
@@ -1025,6 +1070,8 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 		nSekActive = -1;
 	}
 
+	SekFlushFetchPage();
+
 	if (nCount > nSekCount) {
 		nSekCount = nCount;
 	}
@@ -1037,6 +1084,10 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 	}
 	memset(SekExt[nCount], 0, sizeof(struct SekExt));
 
+#ifdef EMU_M68K
+	M68KIdleLoopSize = bBurnIdleDetect ? BURN_IDLE_MAX_LOOP : 0;
+#endif
+
 	// Put in default memory handlers
 	ps = SekExt[nCount];
 
@@ -1206,6 +1257,7 @@ INT32 SekExit()
 	}
 
 	pSekExt = NULL;
+	SekFlushFetchPage();
 
 	nSekActive = -1;
 	nSekCount = -1;
@@ -1271,6 +1323,7 @@ void SekOpen(const INT32 i)
 		nSekActive = i;
 
 		pSekExt = SekExt[nSekActive];						// Point to cpu context
+		SekFlushFetchPage();
 
 #ifdef EMU_A68K
 		if (nSekCPUType[nSekActive] == 0) {
@@ -1314,6 +1367,7 @@ void SekClose()
 #endif
 
 	nSekCycles[nSekActive] = nSekCyclesTotal;
+	SekFlushFetchPage();
 	
 	nSekActive = -1;
 }
@@ -1650,9 +1704,36 @@ void SekRunEnd()
 
 }
 
+// End the active CPU's timeslice, counting only the cycles run so far (for BurnSchedSync())
+void SekRunEndSync()
+{
+#if defined FBNEO_DEBUG
+	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekRunEndSync called without init\n"));
+	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekRunEndSync called when no CPU open\n"));
+#endif
+
+#ifdef EMU_A68K
+	if (nSekCPUType[nSekActive] == 0) {
+		SekRunEnd();											// A68K already only counts the cycles run
+	} else {
+#endif
+
+#ifdef EMU_M68K
+		nSekCyclesToDo -= m68k_ICount;
+		m68k_modify_timeslice(-m68k_ICount);					// m68k_execute() returns the cycles run
+#endif
+
+#ifdef EMU_A68K
+	}
+#endif
+
+}
+
 // Run the active CPU
 INT32 SekRun(const INT32 nCycles)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_SEK);
+
 #if defined FBNEO_DEBUG
 	if (!DebugCPU_SekInitted) bprintf(PRINT_ERROR, _T("SekRun called without init\n"));
 	if (nSekActive == -1) bprintf(PRINT_ERROR, _T("SekRun called when no CPU open\n"));
@@ -1895,6 +1976,8 @@ INT32 SekMapMemory(UINT8* pMemory, UINT32 nStart, UINT32 nEnd, INT32 nType)
 	UINT8* Ptr = pMemory - nStart;
 	UINT8** pMemMap = pSekExt->MemMap + (nStart >> SEK_SHIFT);
 
+	SekFlushFetchPage();
+
 	// Special case for ROM banks
 	if (nType == MAP_ROM) {
 		for (UINT32 i = (nStart & ~SEK_PAGEM); i <= nEnd; i += SEK_PAGE_SIZE, pMemMap++) {
@@ -1930,6 +2013,8 @@ INT32 SekMapHandler(uintptr_t nHandler, UINT32 nStart, UINT32 nEnd, INT32 nType)
 
 	UINT8** pMemMap = pSekExt->MemMap + (nStart >> SEK_SHIFT);
 
+	SekFlushFetchPage();
+
 	// Add to memory map
 	for (UINT32 i = (nStart & ~SEK_PAGEM); i <= nEnd; i += SEK_PAGE_SIZE, pMemMap++) {
 
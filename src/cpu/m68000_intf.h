@@ -98,6 +98,8 @@ struct SekExt {
 	pSekIrqCallback IrqCallback;
 	pSekCmpCallback CmpCallback;
 	pSekTASCallback TASCallback;
+
+	struct BurnIdleState Idle;
 };
 
 #define SEK_DEF_READ_WORD(i, a) { UINT16 d; d = (UINT16)(pSekExt->ReadByte[i](a) << 8); d |= (UINT16)(pSekExt->ReadByte[i]((a) + 1)); return d; }
@@ -150,6 +152,7 @@ void SekReset();
 void SekReset(INT32 nCPU);
 
 void SekRunEnd();
+void SekRunEndSync();
 void SekRunAdjust(const INT32 nCycles);
 INT32 SekRun(const INT32 nCycles);
 INT32 SekRun(INT32 nCPU, INT32 nCycles);
@@ -2273,6 +2273,7 @@ M68KMAKE_OP(bcc, 8, ., .)
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
+		m68ki_idle_branch();
 		return;
 	}
 	USE_CYCLES(CYC_BCC_NOTAKE_B);
@@ -2287,6 +2288,7 @@ M68KMAKE_OP(bcc, 16, ., .)
 		REG_PC -= 2;
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_16(offset);
+		m68ki_idle_branch();
 		return;
 	}
 	REG_PC += 2;
@@ -3136,6 +3138,8 @@ M68KMAKE_OP(bra, 8, ., .)
 	m68ki_branch_8(MASK_OUT_ABOVE_8(REG_IR));
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
+	else
+		m68ki_idle_branch();
 }
 
 
@@ -3147,6 +3151,8 @@ M68KMAKE_OP(bra, 16, ., .)
 	m68ki_branch_16(offset);
 	if(REG_PC == REG_PPC)
 		USE_ALL_CYCLES();
+	else
+		m68ki_idle_branch();
 }
 
 
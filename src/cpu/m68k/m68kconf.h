@@ -227,6 +227,22 @@ unsigned int __fastcall M68KFetchByte(unsigned int a);
 unsigned int __fastcall M68KFetchWord(unsigned int a);
 unsigned int __fastcall M68KFetchLong(unsigned int a);
 
+/* The page the pc was last fetched from, so the prefetch doesn't go through the memory map
+ * for every word.  m68000_intf.cpp empties it whenever the map or the open cpu changes.
+ * Only the fetch is sped up, the core itself is still plain Musashi. */
+#define M68K_FETCH_PAGE_SHIFT	(10)	/* SEK_SHIFT */
+
+extern unsigned char* M68KFetchMemory;	/* memory for the page, less the page's address */
+extern unsigned int M68KFetchPage;		/* address >> M68K_FETCH_PAGE_SHIFT, ~0 for none */
+
+unsigned int __fastcall M68KFetchWordPage(unsigned int a);
+
+/* Idle loop detection (see burn_idle.h).  Taken bcc/bra branches back to no more than
+ * M68KIdleLoopSize bytes before them are passed to M68KIdleCheck with the registers and sr,
+ * which returns non-zero if the rest of the timeslice can be skipped.  0 turns it off. */
+extern unsigned int M68KIdleLoopSize;
+int M68KIdleCheck(unsigned int pc, const void* state, int size);
+
 extern unsigned int (*SekDbgFetchByteDisassembler)(unsigned int);
 extern unsigned int (*SekDbgFetchWordDisassembler)(unsigned int);
 extern unsigned int (*SekDbgFetchLongDisassembler)(unsigned int);
@@ -261,7 +277,22 @@ void __fastcall M68KWriteLong(unsigned int a, unsigned int d);
 #define m68k_read_pcrelative_32(address) M68KFetchLong(address)
 
 /* Read data immediately following the PC */
+#ifdef LSB_FIRST
+INLINE unsigned int M68KFetchWordCached(unsigned int a)
+{
+	a &= 0xffffff;
+
+	if ((a >> M68K_FETCH_PAGE_SHIFT) == M68KFetchPage) {
+		return *(unsigned short*)(M68KFetchMemory + a);
+	}
+
+	return M68KFetchWordPage(a);
+}
+
+#define m68k_read_immediate_16(address) M68KFetchWordCached(address)
+#else
 #define m68k_read_immediate_16(address) M68KFetchWord(address)
+#endif
 #define m68k_read_immediate_32(address) M68KFetchLong(address)
 
 /* Memory access for the disassembler */
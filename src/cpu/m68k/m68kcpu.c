@@ -940,6 +940,19 @@ void m68k_burn_until_irq(int enabled)
 	m68ki_cpu.sleepuntilint = enabled;
 }
 
+/* A loop that keeps coming back with the same registers and nothing written won't leave before
+ * an interrupt, so give up the rest of the timeslice */
+void m68ki_idle_check(void)
+{
+	uint state[17];
+
+	memcpy(state, REG_DA, sizeof(REG_DA));
+	state[16] = m68ki_get_sr();
+
+	if(M68KIdleCheck(REG_PPC, state, sizeof(state)))
+		USE_ALL_CYCLES();
+}
+
 /* ASG: rewrote so that the int_level is a mask of the IPL0/IPL1/IPL2 bits */
 /* KS: Modified so that IPL* bits match with mask positions in the SR
  *     and cleaned out remenants of the interrupt controller.
@@ -1018,6 +1018,7 @@ INLINE void m68ki_jump_vector(uint vector);
 INLINE void m68ki_branch_8(uint offset);
 INLINE void m68ki_branch_16(uint offset);
 INLINE void m68ki_branch_32(uint offset);
+void m68ki_idle_check(void);
 
 /* Status register operations. */
 INLINE void m68ki_set_s_flag(uint value);            /* Only bit 2 of value should be set (i.e. 4 or 0) */
@@ -1453,6 +1454,9 @@ INLINE void m68ki_branch_32(uint offset)
 	m68ki_pc_changed(REG_PC);
 }
 
+/* Pass a taken branch back into a short loop to the idle loop detector (see m68kconf.h) */
+#define m68ki_idle_branch() if(REG_PPC - REG_PC < M68KIdleLoopSize) m68ki_idle_check()
+
 
 
 /* ---------------------------- Status Register --------------------------- */
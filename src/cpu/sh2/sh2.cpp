@@ -33,6 +33,13 @@
 #include "sh2_intf.h"
 #include <stddef.h>
 
+#ifdef SH2_X64_DRC
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include "../mips3/x64/xbyak/xbyak.h"
+#endif
+
 int has_sh2;
 INT32 cps3speedhack; // must be set _after_ Sh2Init();
 INT32 sh2_busyloop_speedhack_mode2;
@@ -168,6 +175,23 @@ static void sh2_internal_w(UINT32 offset, UINT32 data, UINT32 mem_mask);
 
 #define	SH2_MAXHANDLER	(8)
 
+bool bBurnSh2Recompiler = false;
+static bool sh2_use_recompiler = false;
+
+#ifdef SH2_X64_DRC
+class Sh2Drc;
+static int Sh2ExtCount = 0;
+
+static void sh2_drc_map_changed(unsigned int nStart, unsigned int nEnd);
+static void sh2_drc_check_write(UINT32 A);
+static void sh2_drc_flush();
+static void sh2_drc_exit();
+
+// Writes to pages holding recompiled code are checked against it
+#define SH2_DRC_CHECK_WRITE(A)	if (sh2_use_recompiler && pSh2Ext->drc_lines[(A) >> SH2_SHIFT]) sh2_drc_check_write(A);
+#else
+#define SH2_DRC_CHECK_WRITE(A)
+#endif
 
 typedef struct 
 {
@@ -182,6 +206,12 @@ typedef struct
 	
 	unsigned char * opbase;
 	int suspend;
+
+#ifdef SH2_X64_DRC
+	Sh2Drc * drc;
+	int drc_exit;							// set to leave recompiled code early
+	UINT32 * drc_lines[SH2_PAGE_COUNT];		// by page written, which lines of the memory fetched there hold recompiled code
+#endif
 } SH2EXT;
 
 static SH2EXT * pSh2Ext;
@@ -277,6 +307,11 @@ int Sh2MapMemory(unsigned char* pMemory, unsigned int nStart, unsigned int nEnd,
 			}
 		}
 	}
+
+#ifdef SH2_X64_DRC
+	sh2_drc_map_changed(nStart, nEnd);
+#endif
+
 	return 0;
 }
 
@@ -325,6 +360,11 @@ int Sh2MapHandler(uintptr_t nHandler, unsigned int nStart, unsigned int nEnd, in
 		}
 		
 	}
+
+#ifdef SH2_X64_DRC
+	sh2_drc_map_changed(nStart, nEnd);
+#endif
+
 	return 0;
 }
 
@@ -470,6 +510,10 @@ int Sh2Exit()
 
 	has_sh2 = 0;
 
+#ifdef SH2_X64_DRC
+	sh2_drc_exit();
+#endif
+
 	if (Sh2Ext) {
 		free(Sh2Ext);
 		Sh2Ext = NULL;
@@ -499,6 +543,7 @@ int Sh2Init(int nCount)
 
 	cps3speedhack = 0;
 	sh2_busyloop_speedhack_mode2 = 0;
+	sh2_use_recompiler = false;
 
 	Sh2Ext = (SH2EXT *)malloc(sizeof(SH2EXT) * nCount);
 	if (Sh2Ext == NULL) {
@@ -507,6 +552,10 @@ int Sh2Init(int nCount)
 	}
 	memset(Sh2Ext, 0, sizeof(SH2EXT) * nCount);
 
+#ifdef SH2_X64_DRC
+	Sh2ExtCount = nCount;
+#endif
+
 	// init default memory handler
 	for (int i=0; i<nCount; i++) {
 		pSh2Ext = Sh2Ext + i;
@@ -562,6 +611,23 @@ void Sh2SetEatCycles(int i)
 #endif
 
 	sh2->sh2_eat_cycles = i;
+
+#ifdef SH2_X64_DRC
+	sh2_drc_flush();	// the eat cycles are built into the recompiled code
+#endif
+}
+
+int Sh2UseRecompiler(bool use)
+{
+#ifdef SH2_X64_DRC
+	if (sh2_use_recompiler && !use) {
+		sh2_drc_flush();	// writes aren't checked against the recompiled code while it's off
+	}
+#endif
+
+	sh2_use_recompiler = use;
+
+	return 0;
 }
 
 int Sh2GetActive()
@@ -727,6 +793,8 @@ SH2_INLINE void WB(UINT32 A, UINT8 V)
 	if (A >= 0x40000000) return;
 	program_write_byte_32be(A & AM,V); */
 	
+	SH2_DRC_CHECK_WRITE(A)
+
 	unsigned char* pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
@@ -746,6 +814,8 @@ SH2_INLINE void WW(UINT32 A, UINT16 V)
 	if (A >= 0x40000000) return;
 	program_write_word_32be(A & AM,V); */
 
+	SH2_DRC_CHECK_WRITE(A)
+
 	unsigned char * pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
@@ -764,6 +834,8 @@ SH2_INLINE void WL(UINT32 A, UINT32 V)
 	if (A >= 0xc0000000) { program_write_dword_32be(A,V); return; }
 	if (A >= 0x40000000) return;
 	program_write_dword_32be(A & AM,V); */
+	SH2_DRC_CHECK_WRITE(A)
+
 	unsigned char * pr;
 	pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD];
 	if ((uintptr_t)pr >= SH2_MAXHANDLER) {
@@ -3068,6 +3140,10 @@ static void sh2_internal_w(UINT32 offset, UINT32 data, UINT32 mem_mask)
 	UINT32 old = sh2->m[offset];
 	COMBINE_DATA(sh2->m+offset);
 
+#ifdef SH2_X64_DRC
+	pSh2Ext->drc_exit = 1;	// the timers or DMA may have changed, recompiled code has to stop
+#endif
+
 	//  if(offset != 0x20)
 	//      logerror("sh2_internal_w:  Write %08x (%x), %08x @ %08x\n", 0xfffffe00+offset*4, offset, data, mem_mask);
 
@@ -3269,12 +3345,64 @@ static UINT32 sh2_internal_r(UINT32 offset, UINT32 /*mem_mask*/)
 
 // -------------------------------------------------------
 
+SH2_INLINE void sh2_execute(UINT16 opcode)
+{
+	switch (opcode & ( 15 << 12))
+	{
+		case  0<<12: op0000(opcode); break;
+		case  1<<12: op0001(opcode); break;
+		case  2<<12: op0010(opcode); break;
+		case  3<<12: op0011(opcode); break;
+		case  4<<12: op0100(opcode); break;
+		case  5<<12: op0101(opcode); break;
+		case  6<<12: op0110(opcode); break;
+		case  7<<12: op0111(opcode); break;
+		case  8<<12: op1000(opcode); break;
+		case  9<<12: op1001(opcode); break;
+		case 10<<12: op1010(opcode); break;
+		case 11<<12: op1011(opcode); break;
+		case 12<<12: op1100(opcode); break;
+		case 13<<12: op1101(opcode); break;
+		case 14<<12: op1110(opcode); break;
+	default: op1111(opcode); break;
+	}
+}
+
+SH2_INLINE void sh2_check_timers()
+{
+	unsigned int cy = sh2_GetTotalCycles();
+
+	if (sh2->dma_timer_active[0])
+		if ((cy - sh2->dma_timer_base[0]) >= sh2->dma_timer_cycles[0])
+			sh2_dmac_callback(0);
+
+	if (sh2->dma_timer_active[1])
+		if ((cy - sh2->dma_timer_base[1]) >= sh2->dma_timer_cycles[1])
+			sh2_dmac_callback(1);
+
+	if ( sh2->timer_active )
+		if ((cy - sh2->timer_base) >= sh2->timer_cycles)
+			sh2_timer_callback();
+}
+
+#ifdef SH2_X64_DRC
+#include "sh2_x64.h"
+#endif
+
 int Sh2Run(int cycles)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_SH2);
+
 #if defined FBNEO_DEBUG
 	if (!DebugCPU_SH2Initted) bprintf(PRINT_ERROR, _T("Sh2Run called without init\n"));
 #endif
 
+#ifdef SH2_X64_DRC
+	if (sh2_use_recompiler && cycles > 0) {
+		return Sh2RunDrc(cycles);
+	}
+#endif
+
 	sh2->sh2_icount = cycles;
 	sh2->sh2_cycles_to_run = cycles;
 	sh2->end_run = 0;
@@ -3301,25 +3429,7 @@ int Sh2Run(int cycles)
 
 			sh2->ppc = sh2->pc;
 
-			switch (opcode & ( 15 << 12))
-			{
-				case  0<<12: op0000(opcode); break;
-				case  1<<12: op0001(opcode); break;
-				case  2<<12: op0010(opcode); break;
-				case  3<<12: op0011(opcode); break;
-				case  4<<12: op0100(opcode); break;
-				case  5<<12: op0101(opcode); break;
-				case  6<<12: op0110(opcode); break;
-				case  7<<12: op0111(opcode); break;
-				case  8<<12: op1000(opcode); break;
-				case  9<<12: op1001(opcode); break;
-				case 10<<12: op1010(opcode); break;
-				case 11<<12: op1011(opcode); break;
-				case 12<<12: op1100(opcode); break;
-				case 13<<12: op1101(opcode); break;
-				case 14<<12: op1110(opcode); break;
-			default: op1111(opcode); break;
-			}
+			sh2_execute(opcode);
 		}
 
 		if(sh2->test_irq && !sh2->delay)
@@ -3331,25 +3441,7 @@ int Sh2Run(int cycles)
 		sh2->sh2_total_cycles++;
 		sh2->sh2_icount -= sh2->sh2_eat_cycles;
 		
-		// timer check
-		
-		{
-			unsigned int cy = sh2_GetTotalCycles();
-
-
-			if (sh2->dma_timer_active[0])
-				if ((cy - sh2->dma_timer_base[0]) >= sh2->dma_timer_cycles[0])
-					sh2_dmac_callback(0);
-
-			if (sh2->dma_timer_active[1])
-				if ((cy - sh2->dma_timer_base[1]) >= sh2->dma_timer_cycles[1])
-					sh2_dmac_callback(1);
-
-			if ( sh2->timer_active )
-				if ((cy - sh2->timer_base) >= sh2->timer_cycles)
-					sh2_timer_callback();
-		}
-		
+		sh2_check_timers();
 		
 	} while( sh2->sh2_icount > 0 && !sh2->end_run );
 
@@ -3529,6 +3621,12 @@ int Sh2Scan(int nAction)
 				change_pc(sh2->pc & AM); // re-load the opbase
 			}
 #endif
+
+#ifdef SH2_X64_DRC
+			if (nAction & ACB_WRITE) {
+				sh2_drc_flush(); // code in RAM may have changed
+			}
+#endif
 		}
 
 	}
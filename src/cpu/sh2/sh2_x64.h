@@ -0,0 +1,1346 @@
+// SH-2 x86-64 recompiler, included by sh2.cpp when SH2_X64_DRC is defined
+//
+// Straight runs of SH-2 code, up to and including a branch and its delay slot, are translated
+// to x86-64 with xbyak and run as one block.  The SH-2 registers stay in the SH2 struct (rbx
+// points at the SH2EXT), loads and stores go straight to memory mapped with Sh2MapMemory() and
+// call the interpreter's RB()/WB() etc. for handlers, and the rarer or more complicated
+// instructions call the interpreter's own code.
+//
+// Cycles are counted exactly as the interpreter counts them.  A block is only run when the
+// cycles left in the slice, and before the next on-chip timer event, are more than the block
+// takes, otherwise the interpreter steps through it; a block also stops after any handler call
+// that raises an interrupt, changes the pc or the cycle count, suspends or ends the run, and after
+// any write to the on-chip registers.  So a block gives the same result as stepping through it
+// one instruction at a time.
+//
+// Memory that code has been recompiled from is tracked in 32 byte lines.  A write to one of those
+// lines throws away the blocks made from its 64k page, so code copied or patched into RAM is
+// picked up, while data next to the code is written as quickly as anywhere else.  Remapping a
+// page throws away the blocks fetched through it.
+
+#define SH2_DRC_CODE_SIZE		(1024 * 1024 * 16)
+#define SH2_DRC_BLOCK_MAX		64								// instructions per block
+#define SH2_DRC_LINE_SHIFT		5								// code is tracked in 32 byte lines
+#define SH2_DRC_LINES			(SH2_PAGE_SIZE >> SH2_DRC_LINE_SHIFT)
+#define SH2_DRC_INTERPRET		((void*)1)						// in the block table: step through with the interpreter
+
+#define DRC_R(n)				dword[rbx + (UINT32)(offsetof(SH2EXT, sh2.r) + (n) * 4)]
+#define DRC_RW(n)				word[rbx + (UINT32)(offsetof(SH2EXT, sh2.r) + (n) * 4)]
+#define DRC_RB(n)				byte[rbx + (UINT32)(offsetof(SH2EXT, sh2.r) + (n) * 4)]
+#define DRC_SH2(f)				dword[rbx + (UINT32)offsetof(SH2EXT, sh2.f)]
+#define DRC_EXT(f)				dword[rbx + (UINT32)offsetof(SH2EXT, f)]
+
+// CompileOp() results
+enum { DRC_NEXT = 0, DRC_END, DRC_END_SLOT, DRC_STOP };
+
+struct Sh2DrcCodePage {
+	UINT32 nLines[SH2_DRC_LINES / 32];	// lines holding recompiled code
+	std::vector<UINT32> Tables;			// block tables (pc >> 16) with blocks from this page
+};
+
+// Called by the recompiled code ----------------------------------------------
+
+static inline void sh2_drc_update_exit(UINT32 nPc, INT32 nCycles)
+{
+	if (sh2->test_irq || sh2->end_run || pSh2Ext->suspend || sh2->pc != nPc || sh2->sh2_icount != nCycles) {
+		pSh2Ext->drc_exit = 1;
+	}
+}
+
+static UINT32 sh2_drc_read_byte(UINT32 A)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount;
+	UINT32 d = (UINT32)(INT32)(INT8)RB(A);
+	sh2_drc_update_exit(nPc, nCycles);
+	return d;
+}
+
+static UINT32 sh2_drc_read_word(UINT32 A)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount;
+	UINT32 d = (UINT32)(INT32)(INT16)RW(A);
+	sh2_drc_update_exit(nPc, nCycles);
+	return d;
+}
+
+static UINT32 sh2_drc_read_long(UINT32 A)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount;
+	UINT32 d = RL(A);
+	sh2_drc_update_exit(nPc, nCycles);
+	return d;
+}
+
+static void sh2_drc_write_byte(UINT32 A, UINT32 V)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount;
+	WB(A, (UINT8)V);
+	sh2_drc_update_exit(nPc, nCycles);
+}
+
+static void sh2_drc_write_word(UINT32 A, UINT32 V)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount;
+	WW(A, (UINT16)V);
+	sh2_drc_update_exit(nPc, nCycles);
+}
+
+static void sh2_drc_write_long(UINT32 A, UINT32 V)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount;
+	WL(A, V);
+	sh2_drc_update_exit(nPc, nCycles);
+}
+
+// Instructions left to the interpreter, which takes nExtra cycles off itself
+static void sh2_drc_execute(UINT32 opcode, INT32 nExtra)
+{
+	UINT32 nPc = sh2->pc;
+	INT32 nCycles = sh2->sh2_icount - nExtra;
+	sh2_execute((UINT16)opcode);
+	sh2_drc_update_exit(nPc, nCycles);
+}
+
+// The recompiler -------------------------------------------------------------
+
+class Sh2Drc : public Xbyak::CodeGenerator
+{
+public:
+	Sh2Drc(SH2EXT* pExt);
+	~Sh2Drc();
+
+	inline void* GetBlock(UINT32 nPc)
+	{
+		void** pTable = m_pTable[nPc >> SH2_SHIFT];
+		if (pTable && pTable[(nPc & SH2_PAGEM) >> 1]) {
+			return pTable[(nPc & SH2_PAGEM) >> 1];
+		}
+		return NewBlock(nPc);
+	}
+
+	// Cycles the block takes up to its last instruction
+	static inline INT32 BlockCycles(void* pBlock)
+	{
+		return ((INT32*)pBlock)[-1];
+	}
+
+	void Flush();
+	void MapChanged(UINT32 nStart, UINT32 nEnd);
+	void CheckWrite(UINT32 A);
+
+private:
+	SH2EXT* m_pExt;
+	void** m_pTable[SH2_PAGE_COUNT];	// blocks by pc, a table for each 64k page run from
+	std::unordered_map<UINT8*, Sh2DrcCodePage> m_CodePages;
+
+	// The block being compiled
+	UINT8* m_pFetch;					// fetch page
+	UINT32 m_nPage;						// (pc & AM) >> 16
+	UINT32 m_nAddr;						// instruction being compiled
+	UINT32 m_nEnd;						// past the last instruction compiled
+	INT32 m_nEat;
+	INT32 m_nPendCycles;				// cycles and instructions not yet taken off
+	INT32 m_nPendInstr;
+	INT32 m_nCycles;					// the whole block's
+	INT32 m_nLastCycles;				// the last instruction's
+	bool m_bSlot;						// compiling a delay slot
+
+	void* NewBlock(UINT32 nPc);
+	void* Compile(UINT32 nPc);
+	INT32 CompileOp(UINT32 nAddr);
+	void FreeTables(UINT32 nPage);
+	Sh2DrcCodePage& CodePage(UINT8* pHost);
+
+	inline UINT16 ReadOp(UINT32 nAddr)
+	{
+		return *(UINT16*)(m_pFetch + (((nAddr & AM) ^ 2) & SH2_PAGEM));
+	}
+	bool InPage(UINT32 nAddr);
+	bool ReadMatchesFetch();
+	bool IsBranch(UINT16 op);
+
+	void Prolog();
+	void Epilog();
+	void Pending(INT32 nCycles, INT32 nInstr);
+	void Done(INT32 nExtra);
+	void EndBlock();
+	void CheckExit(INT32 nExtra);
+	void Call(void* pFunc);
+	void SlowCall(void* pFunc);
+	void Read(INT32 nSize);
+	void Write(INT32 nSize);
+	void StoreT();
+
+	INT32 Fallback(UINT16 op, INT32 nExtra, bool bEnd);
+	INT32 Branch(UINT32 nAddr, INT32 nExtra);
+	INT32 Memory(INT32 nExtra);
+};
+
+Sh2Drc::Sh2Drc(SH2EXT* pExt) : Xbyak::CodeGenerator(SH2_DRC_CODE_SIZE)
+{
+	m_pExt = pExt;
+	memset(m_pTable, 0, sizeof(m_pTable));
+	memset(m_pExt->drc_lines, 0, sizeof(m_pExt->drc_lines));
+	m_bSlot = false;
+}
+
+Sh2Drc::~Sh2Drc()
+{
+	for (INT32 i = 0; i < SH2_PAGE_COUNT; i++) {
+		FreeTables(i);
+	}
+	memset(m_pExt->drc_lines, 0, sizeof(m_pExt->drc_lines));
+}
+
+void Sh2Drc::FreeTables(UINT32 nPage)
+{
+	if (m_pTable[nPage]) {
+		free(m_pTable[nPage]);
+		m_pTable[nPage] = NULL;
+	}
+}
+
+void Sh2Drc::Flush()
+{
+	reset();
+
+	for (INT32 i = 0; i < SH2_PAGE_COUNT; i++) {
+		FreeTables(i);
+	}
+	m_CodePages.clear();
+	memset(m_pExt->drc_lines, 0, sizeof(m_pExt->drc_lines));
+
+	m_pExt->drc_exit = 1;
+}
+
+void Sh2Drc::MapChanged(UINT32 nStart, UINT32 nEnd)
+{
+	bool bMirror = (nStart < 0x08000000);
+
+	for (UINT64 i = (nStart & ~SH2_PAGEM); i <= nEnd; i += SH2_PAGE_SIZE) {
+		for (UINT32 k = 0; k < 8; k++) {
+			UINT32 nPage = (UINT32)(i >> SH2_SHIFT) | (k << (27 - SH2_SHIFT));
+
+			// Blocks fetched from this page, from any of its mirrors
+			FreeTables(nPage);
+
+			if (k && !bMirror) {
+				continue;
+			}
+
+			// Writes to the page are checked if code was recompiled from the memory fetched there
+			m_pExt->drc_lines[nPage] = NULL;
+			std::unordered_map<UINT8*, Sh2DrcCodePage>::iterator it = m_CodePages.find(m_pExt->MemMap[nPage + SH2_WADD * 2]);
+			if (it != m_CodePages.end()) {
+				m_pExt->drc_lines[nPage] = it->second.nLines;
+			}
+		}
+	}
+
+	m_pExt->drc_exit = 1;
+}
+
+Sh2DrcCodePage& Sh2Drc::CodePage(UINT8* pHost)
+{
+	std::unordered_map<UINT8*, Sh2DrcCodePage>::iterator it = m_CodePages.find(pHost);
+	if (it != m_CodePages.end()) {
+		return it->second;
+	}
+
+	Sh2DrcCodePage& Page = m_CodePages[pHost];
+	memset(Page.nLines, 0, sizeof(Page.nLines));
+
+	// Every page this memory is fetched through.  Writes there may go through a handler (cps3 keeps
+	// a decrypted copy of the code it runs from RAM), so the fetch map is what says code can change.
+	for (INT32 i = 0; i < SH2_PAGE_COUNT; i++) {
+		if (m_pExt->MemMap[i + SH2_WADD * 2] == pHost) {
+			m_pExt->drc_lines[i] = Page.nLines;
+		}
+	}
+
+	return Page;
+}
+
+void Sh2Drc::CheckWrite(UINT32 A)
+{
+	UINT32* pLines = m_pExt->drc_lines[A >> SH2_SHIFT];
+	UINT32 nLine = (A & SH2_PAGEM) >> SH2_DRC_LINE_SHIFT;
+
+	if ((pLines[nLine >> 5] & (1 << (nLine & 31))) == 0) {
+		return;
+	}
+
+	Sh2DrcCodePage& Page = m_CodePages[m_pExt->MemMap[(A >> SH2_SHIFT) + SH2_WADD * 2]];
+	for (UINT32 i = 0; i < Page.Tables.size(); i++) {
+		FreeTables(Page.Tables[i]);
+	}
+	Page.Tables.clear();
+	memset(Page.nLines, 0, sizeof(Page.nLines));
+
+	m_pExt->drc_exit = 1;
+}
+
+void* Sh2Drc::NewBlock(UINT32 nPc)
+{
+	void* pBlock;
+
+	try {
+		pBlock = Compile(nPc);
+	} catch (Xbyak::Error& e) {
+		if (e != Xbyak::ERR_CODE_IS_TOO_BIG) {
+			bprintf(PRINT_ERROR, _T("SH-2 recompiler error %d at %08x\n"), (INT32)e, nPc);
+			Flush();
+			return SH2_DRC_INTERPRET;
+		}
+
+		// Out of room, start again
+		Flush();
+		try {
+			pBlock = Compile(nPc);
+		} catch (Xbyak::Error&) {
+			return SH2_DRC_INTERPRET;
+		}
+	}
+
+	UINT32 nPage = nPc >> SH2_SHIFT;
+	if (m_pTable[nPage] == NULL) {
+		m_pTable[nPage] = (void**)calloc(SH2_PAGE_SIZE / 2, sizeof(void*));
+	}
+	m_pTable[nPage][(nPc & SH2_PAGEM) >> 1] = pBlock;
+
+	return pBlock;
+}
+
+void* Sh2Drc::Compile(UINT32 nPc)
+{
+	m_nPage = (nPc & AM) >> SH2_SHIFT;
+	m_pFetch = m_pExt->MemMap[m_nPage + SH2_WADD * 2];
+
+	if ((uintptr_t)m_pFetch < SH2_MAXHANDLER || (nPc & 1)) {
+		return SH2_DRC_INTERPRET;
+	}
+
+	m_nEat = m_pExt->sh2.sh2_eat_cycles;
+	m_nPendCycles = m_nPendInstr = 0;
+	m_nCycles = m_nLastCycles = 0;
+	m_bSlot = false;
+
+	// The block's cycles go just before its code
+	size_t nStart = getSize();
+	dd(0);
+	void* pBlock = (void*)getCurr();
+
+	Prolog();
+
+	UINT32 nAddr = nPc;
+	for (INT32 nCount = 0; ; nCount++, nAddr += 2) {
+		if (nCount == SH2_DRC_BLOCK_MAX || !InPage(nAddr)) {
+			mov(DRC_SH2(pc), nAddr);
+			EndBlock();
+			break;
+		}
+
+		INT32 nRet = CompileOp(nAddr);
+
+		if (nRet == DRC_STOP) {
+			if (nCount == 0) {
+				setSize(nStart);
+				return SH2_DRC_INTERPRET;
+			}
+			mov(DRC_SH2(pc), nAddr);
+			EndBlock();
+			break;
+		}
+
+		if (nRet != DRC_NEXT) {
+			break;
+		}
+	}
+
+	*((INT32*)pBlock - 1) = m_nCycles - m_nLastCycles;
+
+	// Note where the code came from, writes there throw the block away
+	Sh2DrcCodePage& Page = CodePage(m_pFetch);
+	for (UINT32 a = nPc & SH2_PAGEM; a < m_nEnd - (nPc & ~SH2_PAGEM); a += 2) {
+		UINT32 nLine = a >> SH2_DRC_LINE_SHIFT;
+		Page.nLines[nLine >> 5] |= 1 << (nLine & 31);
+	}
+
+	UINT32 nTable = nPc >> SH2_SHIFT;
+	if (std::find(Page.Tables.begin(), Page.Tables.end(), nTable) == Page.Tables.end()) {
+		Page.Tables.push_back(nTable);
+	}
+
+	return pBlock;
+}
+
+bool Sh2Drc::InPage(UINT32 nAddr)
+{
+	return ((nAddr & AM) >> SH2_SHIFT) == m_nPage;
+}
+
+// The busy loop hacks look at the next instruction with RW(), so they can only be worked out
+// here if reads see the same memory as fetches
+bool Sh2Drc::ReadMatchesFetch()
+{
+	return InPage(m_nAddr + 2) && m_pExt->MemMap[(m_nAddr + 2) >> SH2_SHIFT] == m_pFetch;
+}
+
+// Instructions that can't go in a delay slot, or that end the block
+bool Sh2Drc::IsBranch(UINT16 op)
+{
+	switch (op >> 12) {
+		case 0x0: return (op & 0x0f) == 0x03 || (op & 0x0f) == 0x0b;	// BSRF BRAF RTS SLEEP RTE
+		case 0x4: return (op & 0x1f) == 0x0b;							// JSR JMP
+		case 0x8: return (op & 0x0900) == 0x0900;						// BT BF BT/S BF/S
+		case 0xa:
+		case 0xb: return true;											// BRA BSR
+		case 0xc: return (op & 0x0f00) == 0x0300;						// TRAPA
+	}
+
+	return false;
+}
+
+// Code generation helpers ----------------------------------------------------
+
+#if defined (_WIN64)
+ #define DRC_ARG1		ecx
+ #define DRC_ARG2		edx
+#else
+ #define DRC_ARG1		edi
+ #define DRC_ARG2		esi
+#endif
+
+void Sh2Drc::Prolog()
+{
+	push(rbx);
+	sub(rsp, 32);		// keeps the stack aligned, and the shadow space for Win64 calls
+	mov(rbx, (size_t)m_pExt);
+}
+
+void Sh2Drc::Epilog()
+{
+	add(rsp, 32);
+	pop(rbx);
+	ret();
+}
+
+void Sh2Drc::Pending(INT32 nCycles, INT32 nInstr)
+{
+	if (nCycles) sub(DRC_SH2(sh2_icount), nCycles);
+	if (nInstr) add(DRC_SH2(sh2_total_cycles), nInstr);
+}
+
+// Count the instruction just compiled, nExtra is on top of the eat cycles
+void Sh2Drc::Done(INT32 nExtra)
+{
+	m_nPendCycles += m_nEat + nExtra;
+	m_nPendInstr++;
+	m_nLastCycles = m_nEat + nExtra;
+	m_nCycles += m_nLastCycles;
+}
+
+// The last instruction's eat cycles are left to the dispatcher, which counts them after it has
+// checked for interrupts, as the interpreter does
+void Sh2Drc::EndBlock()
+{
+	Pending(m_nPendCycles - m_nEat, m_nPendInstr - 1);
+	Epilog();
+}
+
+// After a handler or the interpreter has been called: leave once this instruction is done if
+// anything was changed that the dispatcher has to see to
+void Sh2Drc::CheckExit(INT32 nExtra)
+{
+	Xbyak::Label lContinue;
+
+	cmp(DRC_EXT(drc_exit), 0);
+	je(lContinue, T_NEAR);
+	Pending(m_nPendCycles + nExtra, m_nPendInstr);
+	Epilog();
+	L(lContinue);
+}
+
+void Sh2Drc::Call(void* pFunc)
+{
+	mov(rax, (size_t)pFunc);
+	call(rax);
+}
+
+// Address in ecx, data in edx.  The pc and the cycle count are brought up to date for the
+// handler, the cycles are put back afterwards as they're still counted at the end of the block.
+void Sh2Drc::SlowCall(void* pFunc)
+{
+	if (m_bSlot) {
+		mov(eax, DRC_SH2(pc));
+		mov(DRC_SH2(ppc), eax);
+	} else {
+		mov(DRC_SH2(pc), m_nAddr + 2);
+		mov(DRC_SH2(ppc), m_nAddr + 2);
+	}
+	Pending(m_nPendCycles, m_nPendInstr);
+
+#if !defined (_WIN64)
+	mov(DRC_ARG1, ecx);
+	mov(DRC_ARG2, edx);
+#endif
+	Call(pFunc);
+
+	Pending(-m_nPendCycles, -m_nPendInstr);
+}
+
+// Address in ecx, the value read is sign extended into eax
+void Sh2Drc::Read(INT32 nSize)
+{
+	Xbyak::Label lSlow, lDone;
+
+	mov(eax, ecx);
+	shr(eax, SH2_SHIFT);
+	mov(rdx, qword[rbx + rax * 8 + (UINT32)offsetof(SH2EXT, MemMap)]);
+	cmp(rdx, SH2_MAXHANDLER);
+	jb(lSlow, T_NEAR);
+
+	mov(eax, ecx);
+	if (nSize == 1) xor_(eax, 3);
+	if (nSize == 2) xor_(eax, 2);
+	and_(eax, SH2_PAGEM);
+	if (nSize == 1) movsx(eax, byte[rdx + rax]);
+	if (nSize == 2) movsx(eax, word[rdx + rax]);
+	if (nSize == 4) mov(eax, dword[rdx + rax]);
+	jmp(lDone, T_NEAR);
+
+	L(lSlow);
+	if (nSize == 1) SlowCall((void*)sh2_drc_read_byte);
+	if (nSize == 2) SlowCall((void*)sh2_drc_read_word);
+	if (nSize == 4) SlowCall((void*)sh2_drc_read_long);
+
+	L(lDone);
+}
+
+// Address in ecx, data in edx
+void Sh2Drc::Write(INT32 nSize)
+{
+	Xbyak::Label lSlow, lNoCode, lDone;
+
+	// Only a write to a line holding recompiled code has to go the slow way
+	mov(eax, ecx);
+	shr(eax, SH2_SHIFT);
+	mov(r8, qword[rbx + rax * 8 + (UINT32)offsetof(SH2EXT, drc_lines)]);
+	test(r8, r8);
+	jz(lNoCode);
+	mov(r9d, ecx);
+	and_(r9d, SH2_PAGEM);
+	shr(r9d, SH2_DRC_LINE_SHIFT);
+	mov(r10d, r9d);
+	shr(r10d, 5);
+	mov(r10d, dword[r8 + r10 * 4]);
+	bt(r10d, r9d);
+	jc(lSlow, T_NEAR);
+	L(lNoCode);
+
+	mov(r8, qword[rbx + rax * 8 + (UINT32)(offsetof(SH2EXT, MemMap) + SH2_WADD * sizeof(UINT8*))]);
+	cmp(r8, SH2_MAXHANDLER);
+	jb(lSlow, T_NEAR);
+
+	mov(eax, ecx);
+	if (nSize == 1) xor_(eax, 3);
+	if (nSize == 2) xor_(eax, 2);
+	and_(eax, SH2_PAGEM);
+	if (nSize == 1) mov(byte[r8 + rax], dl);
+	if (nSize == 2) mov(word[r8 + rax], dx);
+	if (nSize == 4) mov(dword[r8 + rax], edx);
+	jmp(lDone, T_NEAR);
+
+	L(lSlow);
+	if (nSize == 1) SlowCall((void*)sh2_drc_write_byte);
+	if (nSize == 2) SlowCall((void*)sh2_drc_write_word);
+	if (nSize == 4) SlowCall((void*)sh2_drc_write_long);
+
+	L(lDone);
+}
+
+// T = cl
+void Sh2Drc::StoreT()
+{
+	movzx(ecx, cl);
+	and_(DRC_SH2(sr), ~T);
+	or_(DRC_SH2(sr), ecx);
+}
+
+// Ends an instruction that touched memory
+INT32 Sh2Drc::Memory(INT32 nExtra)
+{
+	CheckExit(nExtra);
+	Done(nExtra);
+
+	return DRC_NEXT;
+}
+
+// Run the instruction with the interpreter, nExtra is the cycles it takes on top of the eat cycles
+INT32 Sh2Drc::Fallback(UINT16 op, INT32 nExtra, bool bEnd)
+{
+	if (m_bSlot) {
+		mov(eax, DRC_SH2(pc));
+		mov(DRC_SH2(ppc), eax);
+	} else {
+		mov(DRC_SH2(pc), m_nAddr + 2);
+		mov(DRC_SH2(ppc), m_nAddr + 2);
+	}
+	Pending(m_nPendCycles, m_nPendInstr);
+	m_nPendCycles = m_nPendInstr = 0;
+
+	mov(DRC_ARG1, op);
+	mov(DRC_ARG2, nExtra);
+	Call((void*)sh2_drc_execute);
+
+	// The interpreter has taken off its extra cycles
+	if (!bEnd) {
+		CheckExit(0);
+	}
+	Done(0);
+	m_nCycles += nExtra;
+	m_nLastCycles += nExtra;
+
+	if (bEnd) {
+		EndBlock();
+		return DRC_END;
+	}
+
+	return DRC_NEXT;
+}
+
+// The delay slot of a branch that has set the pc, then the end of the block
+INT32 Sh2Drc::Branch(UINT32 nAddr, INT32 nExtra)
+{
+	Done(nExtra);
+
+	m_bSlot = true;
+	INT32 nRet = CompileOp(nAddr + 2);
+	m_bSlot = false;
+
+	if (nRet == DRC_NEXT) {
+		EndBlock();
+	}
+
+	return DRC_END_SLOT;
+}
+
+// Instructions ---------------------------------------------------------------
+
+INT32 Sh2Drc::CompileOp(UINT32 nAddr)
+{
+	UINT16 op = ReadOp(nAddr);
+	INT32 n = (op >> 8) & 15;
+	INT32 m = (op >> 4) & 15;
+	INT32 d = op & 0xff;
+
+	m_nAddr = nAddr;
+	m_nEnd = nAddr + 2;
+
+	switch (op >> 12) {
+		case 0x0:
+			switch (op & 0x0f) {
+				case 0x02:
+					switch (m & 3) {
+						case 0: mov(eax, DRC_SH2(sr)); mov(DRC_R(n), eax); break;	// STC SR,Rn
+						case 1: mov(eax, DRC_SH2(gbr)); mov(DRC_R(n), eax); break;	// STC GBR,Rn
+						case 2: mov(eax, DRC_SH2(vbr)); mov(DRC_R(n), eax); break;	// STC VBR,Rn
+					}
+					break;
+
+				case 0x03:
+					if (m & 1) break;		// decoded on the low two bits of m, like the interpreter
+					if (m_bSlot || !InPage(nAddr + 2) || IsBranch(ReadOp(nAddr + 2))) return DRC_STOP;
+					if ((m & 3) == 0) {	// BSRF Rn
+						mov(DRC_SH2(pr), nAddr + 4);
+					}
+					mov(eax, DRC_R(n));	// BRAF Rn
+					add(eax, nAddr + 4);
+					and_(eax, AM);
+					mov(DRC_SH2(pc), eax);
+					return Branch(nAddr, 1);
+
+				case 0x04:	// MOV.B Rm,@(R0,Rn)
+				case 0x05:
+				case 0x06:
+					mov(ecx, DRC_R(n));
+					add(ecx, DRC_R(0));
+					mov(edx, DRC_R(m));
+					Write(1 << ((op & 0x0f) - 4));
+					return Memory(0);
+
+				case 0x07:	// MUL.L Rm,Rn
+					mov(eax, DRC_R(n));
+					imul(eax, DRC_R(m));
+					mov(DRC_SH2(macl), eax);
+					Done(1);
+					return DRC_NEXT;
+
+				case 0x08:
+					switch (m & 3) {
+						case 0: and_(DRC_SH2(sr), ~T); break;								// CLRT
+						case 1: or_(DRC_SH2(sr), T); break;									// SETT
+						case 2: mov(DRC_SH2(mach), 0); mov(DRC_SH2(macl), 0); break;		// CLRMAC
+					}
+					break;
+
+				case 0x09:
+					switch (m & 3) {
+						case 1: and_(DRC_SH2(sr), ~(M | Q | T)); break;						// DIV0U
+						case 2: mov(eax, DRC_SH2(sr)); and_(eax, T); mov(DRC_R(n), eax); break;	// MOVT Rn
+					}
+					break;
+
+				case 0x0a:
+					switch (m & 3) {
+						case 0: mov(eax, DRC_SH2(mach)); mov(DRC_R(n), eax); break;		// STS MACH,Rn
+						case 1: mov(eax, DRC_SH2(macl)); mov(DRC_R(n), eax); break;		// STS MACL,Rn
+						case 2: mov(eax, DRC_SH2(pr)); mov(DRC_R(n), eax); break;			// STS PR,Rn
+					}
+					break;
+
+				case 0x0b:
+					switch (m & 3) {
+						case 0:	// RTS
+							if (m_bSlot || !InPage(nAddr + 2) || IsBranch(ReadOp(nAddr + 2))) return DRC_STOP;
+							mov(eax, DRC_SH2(pr));
+							and_(eax, AM);
+							mov(DRC_SH2(pc), eax);
+							return Branch(nAddr, 1);
+
+						case 1:	// SLEEP
+							if (m_bSlot) return DRC_STOP;
+							return Fallback(op, 2, true);
+
+						case 2:	// RTE, leaves its delay slot to the interpreter
+							if (m_bSlot) return DRC_STOP;
+							return Fallback(op, 3, true);
+					}
+					break;
+
+				case 0x0c:	// MOV.B @(R0,Rm),Rn
+				case 0x0d:
+				case 0x0e:
+					mov(ecx, DRC_R(m));
+					add(ecx, DRC_R(0));
+					Read(1 << ((op & 0x0f) - 0x0c));
+					mov(DRC_R(n), eax);
+					return Memory(0);
+
+				case 0x0f:	// MAC.L @Rm+,@Rn+
+					return Fallback(op, 2, false);
+			}
+			break;
+
+		case 0x1:	// MOV.L Rm,@(disp,Rn)
+			mov(ecx, DRC_R(n));
+			add(ecx, (op & 0x0f) * 4);
+			mov(edx, DRC_R(m));
+			Write(4);
+			return Memory(0);
+
+		case 0x2:
+			switch (op & 0x0f) {
+				case 0x00:	// MOV.B Rm,@Rn
+				case 0x01:
+				case 0x02:
+					mov(ecx, DRC_R(n));
+					mov(edx, DRC_R(m));
+					Write(1 << (op & 0x0f));
+					return Memory(0);
+
+				case 0x04:	// MOV.B Rm,@-Rn
+				case 0x05:
+				case 0x06:
+					mov(edx, DRC_R(m));
+					mov(ecx, DRC_R(n));
+					sub(ecx, 1 << ((op & 0x0f) - 4));
+					mov(DRC_R(n), ecx);
+					Write(1 << ((op & 0x0f) - 4));
+					return Memory(0);
+
+				case 0x07:	// DIV0S Rm,Rn
+					mov(eax, DRC_R(n));
+					mov(edx, DRC_R(m));
+					mov(r8d, DRC_SH2(sr));
+					and_(r8d, ~(M | Q | T));
+					mov(ecx, eax);
+					shr(ecx, 31);
+					shl(ecx, 8);
+					or_(r8d, ecx);		// Q
+					mov(ecx, edx);
+					shr(ecx, 31);
+					shl(ecx, 9);
+					or_(r8d, ecx);		// M
+					xor_(eax, edx);
+					shr(eax, 31);
+					or_(r8d, eax);		// T
+					mov(DRC_SH2(sr), r8d);
+					break;
+
+				case 0x08:	// TST Rm,Rn
+					mov(eax, DRC_R(n));
+					test(DRC_R(m), eax);
+					setz(cl);
+					StoreT();
+					break;
+
+				case 0x09: mov(eax, DRC_R(m)); and_(DRC_R(n), eax); break;	// AND Rm,Rn
+				case 0x0a: mov(eax, DRC_R(m)); xor_(DRC_R(n), eax); break;	// XOR Rm,Rn
+				case 0x0b: mov(eax, DRC_R(m)); or_(DRC_R(n), eax); break;	// OR Rm,Rn
+
+				case 0x0c:	// CMP/STR Rm,Rn
+					return Fallback(op, 0, false);
+
+				case 0x0d:	// XTRCT Rm,Rn
+					mov(eax, DRC_R(m));
+					shl(eax, 16);
+					mov(edx, DRC_R(n));
+					shr(edx, 16);
+					or_(eax, edx);
+					mov(DRC_R(n), eax);
+					break;
+
+				case 0x0e:	// MULU Rm,Rn
+				case 0x0f:	// MULS Rm,Rn
+					if (op & 1) {
+						movsx(eax, DRC_RW(n));
+						movsx(edx, DRC_RW(m));
+					} else {
+						movzx(eax, DRC_RW(n));
+						movzx(edx, DRC_RW(m));
+					}
+					imul(eax, edx);
+					mov(DRC_SH2(macl), eax);
+					break;
+			}
+			break;
+
+		case 0x3:
+			switch (op & 0x0f) {
+				case 0x00: mov(eax, DRC_R(n)); cmp(eax, DRC_R(m)); sete(cl); StoreT(); break;	// CMP/EQ
+				case 0x02: mov(eax, DRC_R(n)); cmp(eax, DRC_R(m)); setae(cl); StoreT(); break;	// CMP/HS
+				case 0x03: mov(eax, DRC_R(n)); cmp(eax, DRC_R(m)); setge(cl); StoreT(); break;	// CMP/GE
+				case 0x06: mov(eax, DRC_R(n)); cmp(eax, DRC_R(m)); seta(cl); StoreT(); break;	// CMP/HI
+				case 0x07: mov(eax, DRC_R(n)); cmp(eax, DRC_R(m)); setg(cl); StoreT(); break;	// CMP/GT
+
+				case 0x04: {	// DIV1 Rm,Rn
+					Xbyak::Label lAdd, lDone;
+
+					// Q = msb ^ carry ^ M, T = !(msb ^ carry)
+					mov(r8d, DRC_SH2(sr));
+					mov(eax, DRC_R(n));
+					mov(ecx, eax);
+					shr(ecx, 31);
+					mov(edx, r8d);
+					and_(edx, T);
+					add(eax, eax);
+					or_(eax, edx);
+					mov(DRC_R(n), eax);
+					mov(edx, DRC_R(m));
+					mov(r9d, r8d);
+					shr(r9d, 1);
+					xor_(r9d, r8d);
+					test(r9d, Q);		// old Q != M
+					jnz(lAdd);
+					sub(eax, edx);
+					jmp(lDone);
+					L(lAdd);
+					add(eax, edx);
+					L(lDone);
+					setc(dl);
+					mov(DRC_R(n), eax);
+					movzx(edx, dl);
+					xor_(ecx, edx);
+					mov(edx, r8d);
+					shr(edx, 9);
+					and_(edx, 1);
+					xor_(edx, ecx);
+					shl(edx, 8);
+					and_(r8d, ~(Q | T));
+					or_(r8d, edx);
+					xor_(ecx, 1);
+					or_(r8d, ecx);
+					mov(DRC_SH2(sr), r8d);
+					break;
+				}
+
+				case 0x05:	// DMULU.L Rm,Rn
+				case 0x0d:	// DMULS.L Rm,Rn
+					mov(eax, DRC_R(n));
+					if (op & 8) {
+						imul(DRC_R(m));
+					} else {
+						mul(DRC_R(m));
+					}
+					mov(DRC_SH2(macl), eax);
+					mov(DRC_SH2(mach), edx);
+					Done(1);
+					return DRC_NEXT;
+
+				case 0x08: mov(eax, DRC_R(m)); sub(DRC_R(n), eax); break;	// SUB Rm,Rn
+				case 0x0c: mov(eax, DRC_R(m)); add(DRC_R(n), eax); break;	// ADD Rm,Rn
+
+				case 0x0a:	// SUBC Rm,Rn
+				case 0x0e:	// ADDC Rm,Rn
+					bt(DRC_SH2(sr), 0);
+					mov(eax, DRC_R(n));
+					if (op & 4) {
+						adc(eax, DRC_R(m));
+					} else {
+						sbb(eax, DRC_R(m));
+					}
+					mov(DRC_R(n), eax);
+					setc(cl);
+					StoreT();
+					break;
+
+				case 0x0b:	// SUBV Rm,Rn
+				case 0x0f:	// ADDV Rm,Rn
+					mov(eax, DRC_R(n));
+					if (op & 4) {
+						add(eax, DRC_R(m));
+					} else {
+						sub(eax, DRC_R(m));
+					}
+					seto(cl);
+					mov(DRC_R(n), eax);
+					StoreT();
+					break;
+			}
+			break;
+
+		case 0x4:
+			switch (op & 0x3f) {
+				case 0x00: case 0x20: shl(DRC_R(n), 1); setc(cl); StoreT(); break;	// SHLL SHAL
+				case 0x01: shr(DRC_R(n), 1); setc(cl); StoreT(); break;				// SHLR
+				case 0x21: sar(DRC_R(n), 1); setc(cl); StoreT(); break;				// SHAR
+				case 0x04: rol(DRC_R(n), 1); setc(cl); StoreT(); break;				// ROTL
+				case 0x05: ror(DRC_R(n), 1); setc(cl); StoreT(); break;				// ROTR
+				case 0x24: bt(DRC_SH2(sr), 0); rcl(DRC_R(n), 1); setc(cl); StoreT(); break;	// ROTCL
+				case 0x25: bt(DRC_SH2(sr), 0); rcr(DRC_R(n), 1); setc(cl); StoreT(); break;	// ROTCR
+				case 0x08: shl(DRC_R(n), 2); break;									// SHLL2
+				case 0x09: shr(DRC_R(n), 2); break;									// SHLR2
+				case 0x18: shl(DRC_R(n), 8); break;									// SHLL8
+				case 0x19: shr(DRC_R(n), 8); break;									// SHLR8
+				case 0x28: shl(DRC_R(n), 16); break;								// SHLL16
+				case 0x29: shr(DRC_R(n), 16); break;								// SHLR16
+				case 0x11: cmp(DRC_R(n), 0); setge(cl); StoreT(); break;			// CMP/PZ
+				case 0x15: cmp(DRC_R(n), 0); setg(cl); StoreT(); break;				// CMP/PL
+
+				case 0x10:	// DT Rn
+					if (!ReadMatchesFetch() || ReadOp(nAddr + 2) == 0x8bfd) {
+						// the DT/BF busy loop, or the interpreter has to look for it
+						return Fallback(op, 0, true);
+					}
+					sub(DRC_R(n), 1);
+					setz(cl);
+					StoreT();
+					break;
+
+				case 0x02: case 0x12: case 0x22: {	// STS.L MACH/MACL/PR,@-Rn
+					mov(ecx, DRC_R(n));
+					sub(ecx, 4);
+					mov(DRC_R(n), ecx);
+					if (op & 0x20) mov(edx, DRC_SH2(pr)); else if (op & 0x10) mov(edx, DRC_SH2(macl)); else mov(edx, DRC_SH2(mach));
+					Write(4);
+					return Memory(0);
+				}
+
+				case 0x03: case 0x13: case 0x23: {	// STC.L SR/GBR/VBR,@-Rn
+					mov(ecx, DRC_R(n));
+					sub(ecx, 4);
+					mov(DRC_R(n), ecx);
+					if (op & 0x20) mov(edx, DRC_SH2(vbr)); else if (op & 0x10) mov(edx, DRC_SH2(gbr)); else mov(edx, DRC_SH2(sr));
+					Write(4);
+					return Memory(1);
+				}
+
+				case 0x06: case 0x16: case 0x26: {	// LDS.L @Rm+,MACH/MACL/PR
+					mov(ecx, DRC_R(n));
+					Read(4);
+					if (op & 0x20) mov(DRC_SH2(pr), eax); else if (op & 0x10) mov(DRC_SH2(macl), eax); else mov(DRC_SH2(mach), eax);
+					add(DRC_R(n), 4);
+					return Memory(0);
+				}
+
+				case 0x17: case 0x27: {				// LDC.L @Rm+,GBR/VBR
+					mov(ecx, DRC_R(n));
+					Read(4);
+					if (op & 0x20) mov(DRC_SH2(vbr), eax); else mov(DRC_SH2(gbr), eax);
+					add(DRC_R(n), 4);
+					return Memory(2);
+				}
+
+				case 0x07:	// LDC.L @Rm+,SR
+				case 0x0e:	// LDC Rm,SR
+					return Fallback(op, (op & 1) ? 2 : 0, true);
+
+				case 0x0a: mov(eax, DRC_R(n)); mov(DRC_SH2(mach), eax); break;	// LDS Rm,MACH
+				case 0x1a: mov(eax, DRC_R(n)); mov(DRC_SH2(macl), eax); break;	// LDS Rm,MACL
+				case 0x2a: mov(eax, DRC_R(n)); mov(DRC_SH2(pr), eax); break;	// LDS Rm,PR
+				case 0x1e: mov(eax, DRC_R(n)); mov(DRC_SH2(gbr), eax); break;	// LDC Rm,GBR
+				case 0x2e: mov(eax, DRC_R(n)); mov(DRC_SH2(vbr), eax); break;	// LDC Rm,VBR
+
+				case 0x0b:	// JSR @Rm
+				case 0x2b:	// JMP @Rm
+					if (m_bSlot || !InPage(nAddr + 2) || IsBranch(ReadOp(nAddr + 2))) return DRC_STOP;
+					mov(eax, DRC_R(n));
+					and_(eax, AM);
+					mov(DRC_SH2(pc), eax);
+					if (op & 0x20) {
+						return Branch(nAddr, 0);
+					}
+					mov(DRC_SH2(pr), nAddr + 4);
+					return Branch(nAddr, 1);
+
+				case 0x1b:	// TAS.B @Rn
+					return Fallback(op, 3, false);
+
+				case 0x0f: case 0x1f: case 0x2f: case 0x3f:	// MAC.W @Rm+,@Rn+
+					return Fallback(op, 2, false);
+			}
+			break;
+
+		case 0x5:	// MOV.L @(disp,Rm),Rn
+			mov(ecx, DRC_R(m));
+			add(ecx, (op & 0x0f) * 4);
+			Read(4);
+			mov(DRC_R(n), eax);
+			return Memory(0);
+
+		case 0x6:
+			switch (op & 0x0f) {
+				case 0x00:	// MOV.B @Rm,Rn
+				case 0x01:
+				case 0x02:
+					mov(ecx, DRC_R(m));
+					Read(1 << (op & 0x0f));
+					mov(DRC_R(n), eax);
+					return Memory(0);
+
+				case 0x04:	// MOV.B @Rm+,Rn
+				case 0x05:
+				case 0x06:
+					mov(ecx, DRC_R(m));
+					Read(1 << ((op & 0x0f) - 4));
+					mov(DRC_R(n), eax);
+					if (n != m) {
+						add(DRC_R(m), 1 << ((op & 0x0f) - 4));
+					}
+					return Memory(0);
+
+				case 0x03: mov(eax, DRC_R(m)); mov(DRC_R(n), eax); break;							// MOV Rm,Rn
+				case 0x07: mov(eax, DRC_R(m)); not_(eax); mov(DRC_R(n), eax); break;				// NOT Rm,Rn
+				case 0x08: mov(eax, DRC_R(m)); rol(ax, 8); mov(DRC_R(n), eax); break;				// SWAP.B Rm,Rn
+				case 0x09: mov(eax, DRC_R(m)); rol(eax, 16); mov(DRC_R(n), eax); break;				// SWAP.W Rm,Rn
+				case 0x0b: mov(eax, DRC_R(m)); neg(eax); mov(DRC_R(n), eax); break;					// NEG Rm,Rn
+				case 0x0c: movzx(eax, DRC_RB(m)); mov(DRC_R(n), eax); break;						// EXTU.B Rm,Rn
+				case 0x0d: movzx(eax, DRC_RW(m)); mov(DRC_R(n), eax); break;						// EXTU.W Rm,Rn
+				case 0x0e: movsx(eax, DRC_RB(m)); mov(DRC_R(n), eax); break;						// EXTS.B Rm,Rn
+				case 0x0f: movsx(eax, DRC_RW(m)); mov(DRC_R(n), eax); break;						// EXTS.W Rm,Rn
+
+				case 0x0a:	// NEGC Rm,Rn
+					mov(ecx, DRC_SH2(sr));
+					and_(ecx, T);
+					mov(eax, DRC_R(m));
+					mov(edx, eax);
+					neg(eax);
+					sub(eax, ecx);
+					mov(DRC_R(n), eax);
+					or_(edx, ecx);
+					setnz(cl);
+					StoreT();
+					break;
+			}
+			break;
+
+		case 0x7:	// ADD #imm,Rn
+			add(DRC_R(n), (UINT32)(INT32)(INT8)d);
+			break;
+
+		case 0x8:
+			switch (n) {
+				case 0x0:	// MOV.B R0,@(disp,Rm)
+				case 0x1:
+					mov(ecx, DRC_R(m));
+					add(ecx, (op & 0x0f) << n);
+					mov(edx, DRC_R(0));
+					Write(1 << n);
+					return Memory(0);
+
+				case 0x4:	// MOV.B @(disp,Rm),R0
+				case 0x5:
+					mov(ecx, DRC_R(m));
+					add(ecx, (op & 0x0f) << (n - 4));
+					Read(1 << (n - 4));
+					mov(DRC_R(0), eax);
+					return Memory(0);
+
+				case 0x8:	// CMP/EQ #imm,R0
+					cmp(DRC_R(0), (UINT32)(INT32)(INT8)d);
+					sete(cl);
+					StoreT();
+					break;
+
+				case 0x9:	// BT disp
+				case 0xb: {	// BF disp
+					Xbyak::Label lNotTaken;
+					if (m_bSlot) return DRC_STOP;
+					test(DRC_SH2(sr), T);
+					if (n == 0x9) jz(lNotTaken, T_NEAR); else jnz(lNotTaken, T_NEAR);
+					mov(DRC_SH2(pc), (nAddr + 4 + (INT8)d * 2) & AM);
+					Pending(m_nPendCycles + 2, m_nPendInstr);
+					Epilog();
+					L(lNotTaken);
+					mov(DRC_SH2(pc), nAddr + 2);
+					Pending(m_nPendCycles, m_nPendInstr);
+					Epilog();
+					Done(0);
+					return DRC_END;
+				}
+
+				case 0xd:	// BT/S disp
+				case 0xf: {	// BF/S disp
+					Xbyak::Label lNotTaken, lDone;
+					if (m_bSlot || !InPage(nAddr + 2) || IsBranch(ReadOp(nAddr + 2))) return DRC_STOP;
+					test(DRC_SH2(sr), T);
+					if (n == 0xd) jz(lNotTaken, T_NEAR); else jnz(lNotTaken, T_NEAR);
+					mov(DRC_SH2(pc), (nAddr + 4 + (INT8)d * 2) & AM);
+					sub(DRC_SH2(sh2_icount), 1);
+					jmp(lDone, T_NEAR);
+					L(lNotTaken);
+					mov(DRC_SH2(pc), (nAddr + 4) & AM);
+					L(lDone);
+					m_nCycles++;		// for the block's length, if taken
+					return Branch(nAddr, 0);
+				}
+			}
+			break;
+
+		case 0x9:	// MOV.W @(disp,PC),Rn
+			if (m_bSlot) return Fallback(op, 0, false);
+			mov(ecx, nAddr + 4 + d * 2);
+			Read(2);
+			mov(DRC_R(n), eax);
+			return Memory(0);
+
+		case 0xa:	// BRA disp
+		case 0xb: {	// BSR disp
+			INT32 nDisp = ((INT32)(op & 0x0fff) << 20) >> 20;
+			if (m_bSlot || !InPage(nAddr + 2) || IsBranch(ReadOp(nAddr + 2))) return DRC_STOP;
+			if ((op & 0x1000) == 0 && nDisp == -2 && (!ReadMatchesFetch() || ReadOp(nAddr + 2) == 0x0009)) {
+				// BRA $ busy loop, leaves its delay slot to the interpreter
+				return Fallback(op, 1, true);
+			}
+			if (op & 0x1000) {
+				mov(DRC_SH2(pr), nAddr + 4);
+			}
+			mov(DRC_SH2(pc), (nAddr + 4 + nDisp * 2) & AM);
+			return Branch(nAddr, 1);
+		}
+
+		case 0xc:
+			switch (n) {
+				case 0x0:	// MOV.B R0,@(disp,GBR)
+				case 0x1:
+				case 0x2:
+					mov(ecx, DRC_SH2(gbr));
+					add(ecx, d << n);
+					mov(edx, DRC_R(0));
+					Write(1 << n);
+					return Memory(0);
+
+				case 0x3:	// TRAPA #imm
+					if (m_bSlot) return DRC_STOP;
+					return Fallback(op, 7, true);
+
+				case 0x4:	// MOV.B @(disp,GBR),R0
+				case 0x5:
+				case 0x6:
+					mov(ecx, DRC_SH2(gbr));
+					add(ecx, d << (n - 4));
+					Read(1 << (n - 4));
+					mov(DRC_R(0), eax);
+					return Memory(0);
+
+				case 0x7:	// MOVA @(disp,PC),R0
+					if (m_bSlot) return Fallback(op, 0, false);
+					mov(DRC_R(0), ((nAddr + 4) & ~3) + d * 4);
+					break;
+
+				case 0x8: test(DRC_R(0), d); setz(cl); StoreT(); break;	// TST #imm,R0
+				case 0x9: and_(DRC_R(0), d); break;						// AND #imm,R0
+				case 0xa: xor_(DRC_R(0), d); break;						// XOR #imm,R0
+				case 0xb: or_(DRC_R(0), d); break;						// OR #imm,R0
+
+				default:	// TST.B AND.B XOR.B OR.B #imm,@(R0,GBR)
+					return Fallback(op, 2, false);
+			}
+			break;
+
+		case 0xd:	// MOV.L @(disp,PC),Rn
+			if (m_bSlot) return Fallback(op, 0, false);
+			mov(ecx, ((nAddr + 4) & ~3) + d * 4);
+			Read(4);
+			mov(DRC_R(n), eax);
+			return Memory(0);
+
+		case 0xe:	// MOV #imm,Rn
+			mov(DRC_R(n), (UINT32)(INT32)(INT8)d);
+			break;
+	}
+
+	// Register only instructions, and the undefined ones (NOP)
+	Done(0);
+
+	return DRC_NEXT;
+}
+
+#undef DRC_ARG1
+#undef DRC_ARG2
+
+// The dispatcher -------------------------------------------------------------
+
+// Point opbase at the next instruction, for the interpreter
+static void sh2_drc_set_opbase()
+{
+#if FAST_OP_FETCH
+	UINT32 A = (sh2->delay ? sh2->delay : sh2->pc) & AM;
+
+	readop_pr = pSh2Ext->MemMap[(A >> SH2_SHIFT) + SH2_WADD * 2];
+	pSh2Ext->opbase = readop_pr - (A & ~SH2_PAGEM);
+#endif
+}
+
+static void sh2_drc_step()
+{
+	UINT16 opcode;
+
+	sh2_drc_set_opbase();
+
+	if (sh2->delay) {
+		opcode = cpu_readop16(sh2->delay & AM);
+		change_pc(sh2->pc & AM);
+		sh2->delay = 0;
+	} else {
+		opcode = cpu_readop16(sh2->pc & AM);
+		sh2->pc += 2;
+	}
+
+	sh2->ppc = sh2->pc;
+
+	sh2_execute(opcode);
+}
+
+// Cycles that can be run before the next on-chip timer event is due
+static inline INT32 sh2_drc_limit()
+{
+	INT32 nLimit = sh2->sh2_icount;
+	UINT32 cy = sh2_GetTotalCycles();
+
+	if (sh2->dma_timer_active[0] && (INT32)(sh2->dma_timer_cycles[0] - (cy - sh2->dma_timer_base[0])) < nLimit)
+		nLimit = sh2->dma_timer_cycles[0] - (cy - sh2->dma_timer_base[0]);
+
+	if (sh2->dma_timer_active[1] && (INT32)(sh2->dma_timer_cycles[1] - (cy - sh2->dma_timer_base[1])) < nLimit)
+		nLimit = sh2->dma_timer_cycles[1] - (cy - sh2->dma_timer_base[1]);
+
+	if (sh2->timer_active && (INT32)(sh2->timer_cycles - (cy - sh2->timer_base)) < nLimit)
+		nLimit = sh2->timer_cycles - (cy - sh2->timer_base);
+
+	return nLimit;
+}
+
+static void sh2_drc_check_write(UINT32 A)
+{
+	pSh2Ext->drc->CheckWrite(A);
+}
+
+static void sh2_drc_map_changed(unsigned int nStart, unsigned int nEnd)
+{
+	if (pSh2Ext->drc) {
+		pSh2Ext->drc->MapChanged(nStart, nEnd);
+	}
+}
+
+static void sh2_drc_flush()
+{
+	for (int i = 0; i < Sh2ExtCount; i++) {
+		if (Sh2Ext[i].drc) {
+			Sh2Ext[i].drc->Flush();
+		}
+	}
+}
+
+static void sh2_drc_exit()
+{
+	for (int i = 0; i < Sh2ExtCount; i++) {
+		delete Sh2Ext[i].drc;
+		Sh2Ext[i].drc = NULL;
+	}
+
+	Sh2ExtCount = 0;
+}
+
+static int Sh2RunDrc(int cycles)
+{
+	if (pSh2Ext->drc == NULL) {
+		pSh2Ext->drc = new Sh2Drc(pSh2Ext);
+	}
+
+	Sh2Drc* drc = pSh2Ext->drc;
+
+	sh2->sh2_icount = cycles;
+	sh2->sh2_cycles_to_run = cycles;
+	sh2->end_run = 0;
+
+	do
+	{
+		if ( pSh2Ext->suspend && cps3speedhack ) {
+			sh2->sh2_total_cycles += cycles;
+			sh2->sh2_icount = 0;
+			break;
+		}
+
+		if (pSh2Ext->suspend == 0) {
+			// An odd pc only comes from a bad jump, the interpreter's misaligned fetches are left to it.
+			// A pending interrupt is taken after the next instruction, so that one is stepped too.
+			void* pBlock = (sh2->delay || (sh2->pc & 1) || sh2->test_irq) ? SH2_DRC_INTERPRET : drc->GetBlock(sh2->pc);
+
+			if (pBlock != SH2_DRC_INTERPRET && sh2_drc_limit() > Sh2Drc::BlockCycles(pBlock)) {
+				pSh2Ext->drc_exit = 0;
+				((void (*)())pBlock)();
+			} else {
+				sh2_drc_step();
+			}
+		}
+
+		if(sh2->test_irq && !sh2->delay)
+		{
+			CHECK_PENDING_IRQ(/*"mame_sh2_execute"*/);
+			sh2->test_irq = 0;
+		}
+
+		sh2->sh2_total_cycles++;
+		sh2->sh2_icount -= sh2->sh2_eat_cycles;
+
+		sh2_check_timers();
+
+	} while( sh2->sh2_icount > 0 && !sh2->end_run );
+
+	sh2_drc_set_opbase();
+
+	cycles = cycles - sh2->sh2_icount;
+
+	sh2->cycle_counts += cycles;
+
+	sh2->sh2_cycles_to_run = sh2->sh2_icount = 0;
+
+	return cycles;
+}
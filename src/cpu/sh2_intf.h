@@ -53,6 +53,7 @@ void Sh2NewFrame();
 void Sh2BurnCycles(int cycles);
 void Sh2Idle(int cycles);
 void Sh2SetEatCycles(int i);
+int Sh2UseRecompiler(bool use); // x86-64 builds with SH2_X64_DRC, call after Sh2Init()
 
 int Sh2Scan(int);
 
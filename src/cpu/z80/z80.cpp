@@ -202,6 +202,10 @@ UINT32 EA;
 
 void (*z80edfe_callback)(Z80_Regs *Regs) = NULL;
 
+/* idle loop detector (see burn_idle.h), 0 turns it off */
+UINT32 z80_idle_loop_size = 0;
+int (*z80_idle_callback)(UINT32 pc, const void *state, int size) = NULL;
+
 static UINT8 SZ[256];		/* zero and sign flags */
 static UINT8 SZ_BIT[256];	/* zero, sign and parity/overflow (=zero) flags for BIT opcode */
 static UINT8 SZP[256];		/* zero, sign and parity flags */
@@ -451,6 +455,26 @@ Z80_INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
 	}
 }
 
+/****************************************************************************/
+/* A loop that keeps coming back with the same registers and nothing        */
+/* written won't leave before an interrupt, so burn the rest of the run     */
+/* as NOPs.  R changes every opcode, so it and what follows it aren't       */
+/* compared.                                                                */
+/****************************************************************************/
+static void z80_idle_check()
+{
+	if( z80_idle_callback(PRVPC, &Z80, offsetof(Z80_Regs, r)) && z80_ICount > 0 )
+	{
+		int n = (z80_ICount + 3) / 4;
+		R += n;
+		z80_ICount -= 4 * n;
+	}
+}
+
+#define IDLE_CHECK()											\
+	if( (UINT16)(PRVPC - PCD) < z80_idle_loop_size )			\
+		z80_idle_check()
+
 /***************************************************************
  * define an opcode function
  ***************************************************************/
@@ -697,12 +721,14 @@ Z80_INLINE UINT32 ARG16(void)
 					2, cc[Z80_TABLE_op][0x31]+cc[Z80_TABLE_op][0xc3]); \
 		}														\
 	}															\
+	IDLE_CHECK();												\
 }
 #else
 #define JP {													\
 	PCD = ARG16();												\
 	WZ = PCD;													\
 	change_pc(PCD);												\
+	IDLE_CHECK();												\
 }
 #endif
 
@@ -716,6 +742,7 @@ Z80_INLINE UINT32 ARG16(void)
 		PCD = ARG16();											\
 		WZ = PCD;												\
 		change_pc(PCD);											\
+		IDLE_CHECK();											\
 	}															\
 	else														\
 	{															\
@@ -761,6 +788,7 @@ Z80_INLINE UINT32 ARG16(void)
 				   2, cc[Z80_TABLE_op][0x31]+cc[Z80_TABLE_op][0x18]); \
 		}														\
 	}															\
+	IDLE_CHECK();												\
 }
 
 /***************************************************************
@@ -774,6 +802,7 @@ Z80_INLINE UINT32 ARG16(void)
 	    WZ = PC;													\
 		CC(ex,opcode);											\
 		change_pc(PCD);											\
+		IDLE_CHECK();											\
 	}															\
 	else PC++;													\
 
@@ -3564,6 +3593,7 @@ void Z80Exit()
 	if (SZHVC_sub) free(SZHVC_sub);
 	SZHVC_sub = NULL;
 	z80edfe_callback = NULL;
+	z80_idle_loop_size = 0;
 }
 
 int Z80Execute(int cycles)
@@ -75,6 +75,8 @@ void Z80StopExecute();
 
 extern unsigned char Z80Vector;
 extern void (*z80edfe_callback)(Z80_Regs *Regs);
+extern UINT32 z80_idle_loop_size;
+extern int (*z80_idle_callback)(UINT32 pc, const void *state, int size);
 extern int z80_ICount;
 extern UINT32 EA;
 
@@ -23,6 +23,8 @@ struct ZetExt {
 	
 	UINT32 BusReq;
 	UINT32 ResetLine;
+
+	struct BurnIdleState Idle;
 };
  
 static INT32 nZetCyclesDone[MAX_Z80];
@@ -33,6 +35,7 @@ static UINT32 Z80EA[MAX_Z80];
 
 static INT32 nOpenedCPU = -1;
 static INT32 nCPUCount = 0;
+static UINT32 nZetWrites = 0;						// Any write makes a loop not idle
 INT32 nHasZet = -1;
 
 cpu_core_config ZetConfig =
@@ -66,6 +69,7 @@ UINT8 __fastcall ZetReadIO(UINT32 a)
 
 void __fastcall ZetWriteIO(UINT32 a, UINT8 d)
 {
+	nZetWrites++;
 	ZetCPUContext[nOpenedCPU]->ZetOut(a, d);
 }
 
@@ -87,6 +91,8 @@ UINT8 __fastcall ZetReadProg(UINT32 a)
 
 void __fastcall ZetWriteProg(UINT32 a, UINT8 d)
 {
+	nZetWrites++;
+
 	// check mem map
 	UINT8 * pr = ZetCPUContext[nOpenedCPU]->pZetMemMap[0x100 | (a >> 8)];
 	if (pr != NULL) {
@@ -201,6 +207,11 @@ UINT8 ZetCheatRead(UINT32 a)
 	return ZetReadByte(a);
 }
 
+static int ZetIdleCheck(UINT32 pc, const void* state, int size)
+{
+	return BurnIdleCheck(&ZetCPUContext[nOpenedCPU]->Idle, _T("Z80"), nOpenedCPU, pc, nZetWrites, state, size);
+}
+
 INT32 ZetInit(INT32 nCPU)
 {
 	DebugCPU_ZetInitted = 1;
@@ -239,6 +250,9 @@ INT32 ZetInit(INT32 nCPU)
 	Z80SetProgramWriteHandler(ZetWriteProg);
 	Z80SetCPUOpReadHandler(ZetReadOp);
 	Z80SetCPUOpArgReadHandler(ZetReadOpArg);
+
+	z80_idle_callback = ZetIdleCheck;
+	z80_idle_loop_size = bBurnIdleDetect ? BURN_IDLE_MAX_LOOP : 0;
 	
 	nCPUCount = (nCPU+1) % MAX_Z80;
 
@@ -378,6 +392,8 @@ static void ZetCPUPop()
 
 INT32 ZetRun(INT32 nCycles)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_ZET);
+
 #if defined FBNEO_DEBUG
 	if (!DebugCPU_ZetInitted) bprintf(PRINT_ERROR, _T("ZetRun called without init\n"));
 	if (nOpenedCPU == -1) bprintf(PRINT_ERROR, _T("ZetRun called when no CPU open\n"));
@@ -8,6 +8,8 @@
 #include "ringbuffer.h"
 
 static ring_buffer<short> *buffer = nullptr;
+static rate_control rate;
+static short *resampled = nullptr;
 static pa_simple *pa_stream = nullptr;
 static std::thread *streamer_thread = nullptr;
 static volatile bool streamer_stop = false;
@@ -36,13 +38,18 @@ static int pas_blank_sound()
 static int pas_sound_check()
 {
     // 5 segments ahead...
-    if (buffer->size() >= (samples_per_segment * nAudSegCount)) {
+    size_t target = samples_per_segment * nAudSegCount;
+    size_t fill = buffer->size();
+    if (fill >= target) {
         std::this_thread::sleep_for(std::chrono::milliseconds(2));
         return 0;
     }
 
     pas_get_next_sound(1);
-    buffer->write(nAudNextSound, samples_per_segment);
+
+    // aim for half a segment under the top, where the fill level sits between frames
+    size_t frames = rate.resample(nAudNextSound, nAudSegLen, resampled, rate.ratio(fill, target - samples_per_segment / 2));
+    buffer->write(resampled, frames * 2);
     return 0;
 }
 
@@ -100,6 +107,10 @@ static int pas_init()
 
     nAudNextSound = new short[samples_per_segment];
 
+    delete [] resampled;
+    resampled = new short[rate.max_output(nAudSegLen) * 2];
+    rate.reset();
+
     pas_set_callback(nullptr);
     pas_default_sound_filler(0);
 
@@ -0,0 +1,180 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+// Sound ring buffer and dynamic rate control, shared by the SDL and PulseAudio outputs
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Single producer, single consumer ring buffer.
+//
+// One thread writes (the emulator) and one thread reads (the sound card callback or streamer)
+// without locks.  The read and write positions are atomics on cache lines of their own; the
+// writer publishes what it wrote with a release store that the reader picks up with an acquire
+// load, and the reader hands back the space the same way.  The size is rounded up to a power of
+// two so positions wrap with a mask, and a write or read is at most two memcpy()s.
+template<class T>
+class ring_buffer {
+    static const size_t cache_line = 64;
+
+    std::atomic<size_t> head;   // read position, only changed by the reader
+    char pad0[cache_line - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> tail;   // write position, only changed by the writer
+    char pad1[cache_line - sizeof(std::atomic<size_t>)];
+    T *buffer;
+    size_t mask;
+
+public:
+    ring_buffer(size_t buffer_size_) {
+        size_t buffer_size = 1;
+        while (buffer_size < buffer_size_)
+            buffer_size <<= 1;
+
+        buffer = new T[buffer_size]();
+        mask = buffer_size - 1;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+    ~ring_buffer() {
+        delete [] buffer;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    size_t size() const {
+        size_t head_ = head.load(std::memory_order_acquire);
+        return tail.load(std::memory_order_acquire) - head_;
+    }
+
+    bool available() const {
+        return size() > 0;
+    }
+
+    // Writer only: queue lenght elements of silence
+    void virtual_write(size_t lenght) {
+        size_t tail_ = tail.load(std::memory_order_relaxed);
+        size_t space = capacity() - (tail_ - head.load(std::memory_order_acquire));
+        if (lenght > space)
+            lenght = space;
+
+        for (size_t i = 0; i < lenght; i++)
+            buffer[(tail_ + i) & mask] = T();
+
+        tail.store(tail_ + lenght, std::memory_order_release);
+    }
+
+    // Writer only: returns how much fitted
+    size_t write(const T *buf, size_t lenght) {
+        size_t tail_ = tail.load(std::memory_order_relaxed);
+        size_t space = capacity() - (tail_ - head.load(std::memory_order_acquire));
+        if (lenght > space)
+            lenght = space;
+
+        size_t pos = tail_ & mask;
+        size_t first = capacity() - pos;
+        if (first > lenght)
+            first = lenght;
+
+        memcpy(buffer + pos, buf, first * sizeof(T));
+        memcpy(buffer, buf + first, (lenght - first) * sizeof(T));
+
+        tail.store(tail_ + lenght, std::memory_order_release);
+        return lenght;
+    }
+
+    // Reader only: returns how much there was
+    size_t read(T *buf, size_t lenght) {
+        size_t head_ = head.load(std::memory_order_relaxed);
+        size_t used = tail.load(std::memory_order_acquire) - head_;
+        if (lenght > used)
+            lenght = used;
+
+        size_t pos = head_ & mask;
+        size_t first = capacity() - pos;
+        if (first > lenght)
+            first = lenght;
+
+        memcpy(buf, buffer + pos, first * sizeof(T));
+        memcpy(buf + first, buffer, (lenght - first) * sizeof(T));
+
+        head.store(head_ + lenght, std::memory_order_release);
+        return lenght;
+    }
+};
+
+// Dynamic rate control.
+//
+// Each frame of stereo sound is resampled before it goes in the ring, by a ratio nudged up to
+// max_delta (0.5%) away from 1.0 by how far the ring's fill level is from the target: below the
+// target a few more samples are made, above it a few less.  Small differences between the
+// emulated rate and the sound card's clock, and frames that don't arrive exactly on time, then
+// pull the fill level back to the target instead of running dry (crackle) or piling up (lag),
+// so the target can be kept low.  The pitch change is too small to hear.
+class rate_control {
+    double max_delta;
+    double pos;                 // of the next output sample, in input frames from the last frame of the previous block
+    int16_t last[2];
+
+public:
+    rate_control(double max_delta_ = 0.005) : max_delta(max_delta_) {
+        reset();
+    }
+
+    void reset() {
+        pos = 0.0;
+        last[0] = last[1] = 0;
+    }
+
+    // fill and target in the same units (samples or frames)
+    double ratio(size_t fill, size_t target) const {
+        if (target == 0)
+            return 1.0;
+
+        double d = ((double)target - (double)fill) / (double)target;
+        if (d > 1.0) d = 1.0;
+        if (d < -1.0) d = -1.0;
+
+        return 1.0 + max_delta * d;
+    }
+
+    // Largest number of frames resample() makes from frames of input
+    size_t max_output(size_t frames) const {
+        return (size_t)(frames * (1.0 + max_delta)) + 2;
+    }
+
+    // Linear interpolation of frames stereo frames from in to out, returns the number of frames made
+    size_t resample(const int16_t *in, size_t frames, int16_t *out, double ratio) {
+        if (frames == 0)
+            return 0;
+
+        double step = 1.0 / ratio;
+        size_t made = 0;
+
+        // position 0 is the last frame of the previous block, position n is in[n - 1]
+        while (pos < (double)frames) {
+            size_t i = (size_t)pos;
+            double frac = pos - (double)i;
+
+            const int16_t *a = (i == 0) ? last : (in + (i - 1) * 2);
+            const int16_t *b = in + i * 2;
+
+            out[made * 2 + 0] = (int16_t)(a[0] + (b[0] - a[0]) * frac);
+            out[made * 2 + 1] = (int16_t)(a[1] + (b[1] - a[1]) * frac);
+            made++;
+
+            pos += step;
+        }
+
+        pos -= (double)frames;
+        last[0] = in[(frames - 1) * 2 + 0];
+        last[1] = in[(frames - 1) * 2 + 1];
+
+        return made;
+    }
+};
+
+#endif // RINGBUFFER_H
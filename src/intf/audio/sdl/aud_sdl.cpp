@@ -3,6 +3,8 @@
 #include <SDL.h>
 #include "burner.h"
 #include "aud_dsp.h"
+#include "burn_profile.h"
+#include "ringbuffer.h"
 #include <math.h>
 
 static unsigned int nSoundFps;
@@ -12,37 +14,23 @@ int (*GetNextSound)(int);				// Callback used to request more sound
 
 static SDL_AudioSpec audiospec;
 
-static short* SDLAudBuffer;
-static int nSDLPlayPos;
-static int nSDLFillSeg;
-static int nAudLoopLen;
+static ring_buffer<short>* SDLAudRing = NULL;		// sound waiting to be played, written here and read by the callback
+static rate_control SDLAudRate;
+static short* SDLAudResampled = NULL;
+static short* SDLAudMix = NULL;						// what the callback mixes into the stream
+static int nSDLTarget;								// samples to keep in the ring
 
 void audiospec_callback(void* /* data */, Uint8* stream, int len)
 {
-//	dprintf(_T("audiospec_callback %i"), len);
+	int nSamples = len >> 1;
+	int nRead = SDLAudRing->read(SDLAudMix, nSamples);
 
-	int end = nSDLPlayPos + len;
-	if (end > nAudLoopLen) {
-	
-//		dprintf(_T(" %i - %i"), nSDLPlayPos, nSDLPlayPos + nAudLoopLen - nSDLPlayPos);
-	
-		SDL_MixAudio(stream, (Uint8*)SDLAudBuffer + nSDLPlayPos, nAudLoopLen - nSDLPlayPos, nSDLVolume);
-		end -= nAudLoopLen;
-
-//		dprintf(_T(", %i - %i (%i)"), 0, end, nAudLoopLen - nSDLPlayPos + end);
-
-		SDL_MixAudio(stream + nAudLoopLen - nSDLPlayPos, (Uint8*)SDLAudBuffer, end, nSDLVolume);
-		nSDLPlayPos = end;
-	} else {
-		SDL_MixAudio(stream, (Uint8*)SDLAudBuffer + nSDLPlayPos, len, nSDLVolume);
-		nSDLPlayPos = end;
-		
-		if (nSDLPlayPos == nAudLoopLen) {
-			nSDLPlayPos = 0;
-		}
+	if (nRead < nSamples) {
+		memset(SDLAudMix + nRead, 0, (nSamples - nRead) << 1);	// ran dry, play silence
 	}
 
-//	dprintf(_T("\n"));
+	memset(stream, 0, len);
+	SDL_MixAudio(stream, (Uint8*)SDLAudMix, len, nSDLVolume);
 }
 
 static int SDLSoundGetNextSoundFiller(int)							// int bDraw
@@ -65,59 +53,38 @@ static int SDLSoundBlankSound()
 	return 0;
 }
 
-#define WRAP_INC(x) { x++; if (x >= nAudSegCount) x = 0; }
-
 static int SDLSoundCheck()
 {
-	int nPlaySeg, nFollowingSeg;
-
 	if (!bAudPlaying) {
 		dprintf(_T("SDLSoundCheck (not playing)\n"));
 		return 0;
 	}
 
-	// Since the SDL buffer is smaller than a segment, only fill the buffer up to the start of the currently playing segment
-	nPlaySeg = nSDLPlayPos / (nAudSegLen << 2) - 1;
-
-//	dprintf(_T("SDLSoundCheck (seg %i)\n"), nPlaySeg);
+	int nFill = SDLAudRing->size();
 
-	if (nPlaySeg >= nAudSegCount) {
-		nPlaySeg -= nAudSegCount;
-	}
-	if (nPlaySeg < 0) {
-		nPlaySeg = nAudSegCount - 1;
-	}
-
-	if (nSDLFillSeg == nPlaySeg) {
+	if (nFill >= nSDLTarget) {
 		SDL_Delay(1);
 		return 0;
 	}
 
-	// work out which seg we will fill next
-	nFollowingSeg = nSDLFillSeg;
-	WRAP_INC(nFollowingSeg);
-
-	while (nSDLFillSeg != nPlaySeg) {
-		int bDraw;
-
-		// fill nSDLFillSeg
-//		dprintf(_T("Filling seg %i at %i\n"), nSDLFillSeg, nSDLFillSeg * (nAudSegLen << 2));
-
-		bDraw = (nFollowingSeg == nPlaySeg);//	|| bAlwaysDrawFrames;	// If this is the last seg of sound, flag bDraw (to draw the graphics)
+	while (nFill < nSDLTarget) {
+		int bDraw = (nFill + (nAudSegLen << 1) >= nSDLTarget);		// If this is the last seg of sound, flag bDraw (to draw the graphics)
 
-//		nAudNextSound = SDLAudBuffer + nSDLFillSeg * (nAudSegLen << 1);
 		GetNextSound(bDraw);										// get more sound into nAudNextSound
 
-//		if (nAudDSPModule)	{
-//			DspDo(nAudNextSound, nAudSegLen);
-//		}
+		{
+			BURN_PROFILE_ZONE(PRF_ZONE_AUDIO);
 
-		memcpy((char*)SDLAudBuffer + nSDLFillSeg * (nAudSegLen << 2), nAudNextSound, nAudSegLen << 2);
+			// aim for half a segment under the target, where the fill level sits between frames
+			double dRatio = SDLAudRate.ratio(nFill, nSDLTarget - nAudSegLen);
+			int nFrames = SDLAudRate.resample(nAudNextSound, nAudSegLen, SDLAudResampled, dRatio);
 
-		nSDLFillSeg = nFollowingSeg;
-		WRAP_INC(nFollowingSeg);
+			SDLAudRing->write(SDLAudResampled, nFrames << 1);
+		}
+
+		nFill = SDLAudRing->size();
 	}
-	
+
 	return 0;
 }
 
@@ -127,8 +94,14 @@ static int SDLSoundExit()
 
 	SDL_CloseAudio();
 
-	free(SDLAudBuffer);
-	SDLAudBuffer = NULL;
+	delete SDLAudRing;
+	SDLAudRing = NULL;
+
+	free(SDLAudResampled);
+	SDLAudResampled = NULL;
+
+	free(SDLAudMix);
+	SDLAudMix = NULL;
 
 	free(nAudNextSound);
 	nAudNextSound = NULL;
@@ -160,7 +133,6 @@ static int SDLSoundInit()
 
 	nSoundFps = nAppVirtualFps;
 	nAudSegLen = (nAudSampleRate[0] * 100 + (nSoundFps >> 1)) / nSoundFps;
-	nAudLoopLen = (nAudSegLen * nAudSegCount) << 2;
 	for (nSDLBufferSize = 64; nSDLBufferSize < (nAudSegLen >> 1); nSDLBufferSize <<= 1) { }
 
 	audiospec_req.freq = nAudSampleRate[0];
@@ -169,13 +141,18 @@ static int SDLSoundInit()
 	audiospec_req.samples = nSDLBufferSize;
 	audiospec_req.callback = audiospec_callback;
 
-	SDLAudBuffer = (short*)malloc(nAudLoopLen);
-	if (SDLAudBuffer == NULL) {
-		dprintf(_T("Couldn't malloc SDLAudBuffer\n"));
+	// keep as much as the segments used to hold, less the one being played
+	nSDLTarget = (nAudSegLen << 1) * ((nAudSegCount > 2) ? (nAudSegCount - 1) : 2);
+
+	SDLAudRing = new ring_buffer<short>((nSDLTarget + (nAudSegLen << 1)) * 2);
+	SDLAudRate.reset();
+
+	SDLAudResampled = (short*)malloc(SDLAudRate.max_output(nAudSegLen) << 2);
+	if (SDLAudResampled == NULL) {
+		dprintf(_T("Couldn't malloc SDLAudResampled\n"));
 		SDLSoundExit();
 		return 1;
 	}
-	memset(SDLAudBuffer, 0, nAudLoopLen);
 
 	nAudNextSound = (short*)malloc(nAudSegLen << 2);
 	if (nAudNextSound == NULL) {
@@ -183,15 +160,18 @@ static int SDLSoundInit()
 		return 1;
 	}
 
-	nSDLPlayPos = 0;
-	nSDLFillSeg = nAudSegCount - 1;
-
 	if(SDL_OpenAudio(&audiospec_req, &audiospec)) {
 		fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
 		dprintf(_T("Couldn't open audio: %s\n"), SDL_GetError());
 		return 1;
 	}		
 
+	SDLAudMix = (short*)malloc(audiospec.size);
+	if (SDLAudMix == NULL) {
+		SDLSoundExit();
+		return 1;
+	}
+
 	SDLSetCallback(NULL);
 
 	return 0;
@@ -63,6 +63,7 @@ static struct {
 } mouseState;
 
 extern int nExitEmulator;
+extern bool bRunRewinding;
 
 static int nInitedSubsytems = 0;
 static SDL_Joystick* JoyList[MAX_JOYSTICKS];
@@ -260,6 +261,8 @@ static void scanKeyboard()
 		MakeScreenShot();
 	}
 	screenshotDown = keyState[SDLK_F10];
+
+	bRunRewinding = keyState[SDLK_BACKSPACE] != 0;
 }
 
 static void scanJoysticks()
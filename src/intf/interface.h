@@ -104,6 +104,12 @@ double ProfileProfileReadLast(INT32 nSubSustem);
 double ProfileProfileReadAverage(INT32 nSubSustem);
 InterfaceInfo* ProfileGetInfo();
 
+// prf_zones.cpp
+INT32 ProfileZonesInit(const char* szCsvName);
+INT32 ProfileZonesFrame();
+INT32 ProfileZonesSummary(FILE* fp);
+INT32 ProfileZonesExit();
+
 // Audio Output plugin
 struct AudOut {
 	INT32   (*BlankSound)();
@@ -0,0 +1,105 @@
+// Profiling zones - per-frame CSV and summary of the zones timed in burn (see burn_profile.h)
+#include "burner.h"
+#include "burn_profile.h"
+
+static FILE* fZoneCsv = NULL;
+
+static double ZoneMs(UINT64 nTicks)
+{
+	return (double)nTicks / 1000000.0;
+}
+
+// Start collecting, if szCsvName isn't NULL a line with every zone's time is written for each frame
+INT32 ProfileZonesInit(const char* szCsvName)
+{
+	ProfileZonesExit();
+
+	BurnProfileZonesReset();
+
+	if (szCsvName) {
+		if ((fZoneCsv = fopen(szCsvName, "wt")) == NULL) {
+			return 1;
+		}
+
+		fprintf(fZoneCsv, "frame");
+		for (INT32 i = 0; i < PRF_ZONE_MAX; i++) {
+			fprintf(fZoneCsv, ",%s_ms", BurnProfileZoneInfo[i].szName);
+		}
+		fprintf(fZoneCsv, "\n");
+	}
+
+	bBurnProfileZones = true;
+
+	return 0;
+}
+
+// Call once per emulated frame, after the frame has been presented
+INT32 ProfileZonesFrame()
+{
+	if (!bBurnProfileZones) {
+		return 1;
+	}
+
+	if (fZoneCsv) {
+		fprintf(fZoneCsv, "%u", nBurnProfileFrames);
+		for (INT32 i = 0; i < PRF_ZONE_MAX; i++) {
+			fprintf(fZoneCsv, ",%.4f", ZoneMs(BurnProfileZoneInfo[i].nTicks));
+		}
+		fprintf(fZoneCsv, "\n");
+	}
+
+	BurnProfileZonesFrameEnd();
+
+	return 0;
+}
+
+// Print the average per-frame breakdown
+INT32 ProfileZonesSummary(FILE* fp)
+{
+	UINT32 nFrames = nBurnProfileFrames;
+
+	if (nFrames == 0) {
+		return 1;
+	}
+
+	UINT64 nFrameTicks = BurnProfileZoneInfo[PRF_ZONE_FRAME].nTotalTicks;
+
+	fprintf(fp, "Profile zones, %u frames (ms per frame, avg and max include nested zones, self doesn't):\n", nFrames);
+	fprintf(fp, "  %-10s %9s %9s %9s %7s %9s\n", "zone", "avg", "self", "max", "%frame", "calls");
+
+	for (INT32 i = 0; i < PRF_ZONE_MAX; i++) {
+		struct BurnProfileZone* pz = &BurnProfileZoneInfo[i];
+
+		if (pz->nTotalCalls == 0) {
+			continue;
+		}
+
+		fprintf(fp, "  %-10s %9.3f %9.3f %9.3f %6.1f%% %9.1f\n", pz->szName, ZoneMs(pz->nTotalTicks) / nFrames, ZoneMs(pz->nTotalSelfTicks) / nFrames,
+			ZoneMs(pz->nMaxTicks), nFrameTicks ? 100.0 * pz->nTotalTicks / nFrameTicks : 0.0, (double)pz->nTotalCalls / nFrames);
+	}
+
+	// The frame's own time, outside any cpu, draw, transfer or sound zone, is mostly drawing in drivers that aren't instrumented
+	if (nFrameTicks) {
+		UINT64 nOther = BurnProfileZoneInfo[PRF_ZONE_FRAME].nTotalSelfTicks;
+
+		fprintf(fp, "  %-10s %9.3f %9s %9s %6.1f%%\n", "other", ZoneMs(nOther) / nFrames, "", "", 100.0 * nOther / nFrameTicks);
+	}
+
+	return 0;
+}
+
+INT32 ProfileZonesExit()
+{
+	if (bBurnProfileZones) {
+		ProfileZonesSummary(stdout);
+	}
+
+	bBurnProfileZones = false;
+
+	if (fZoneCsv) {
+		fclose(fZoneCsv);
+		fZoneCsv = NULL;
+	}
+
+	return 0;
+}
@@ -0,0 +1,79 @@
+// Profiling support
+#include "burner.h"
+
+#include <chrono>
+
+typedef std::chrono::steady_clock cntClock;
+
+static struct { INT64 start; INT64 count[256]; INT64 tally; int index; int max_count; } cntSubsysInfo[16];
+
+static INT64 cntGetTicks()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(cntClock::now().time_since_epoch()).count();
+}
+
+int cntExit()
+{
+	return 0;
+}
+
+int cntInit()
+{
+	for (int i = 0; i < 16; i++) {
+		for (int j = 0; j < 256; j++) {
+			cntSubsysInfo[i].count[j] = 0;
+		}
+		cntSubsysInfo[i].start = 0;
+		cntSubsysInfo[i].tally = 0;
+		cntSubsysInfo[i].index = 0;
+		cntSubsysInfo[i].max_count = 32;
+	}
+
+	return 0;
+}
+
+int cntProfileStart(int nSubSystem)
+{
+	cntSubsysInfo[nSubSystem].start = cntGetTicks();
+
+	return 0;
+}
+
+int cntProfileEnd(int nSubSystem)
+{
+	cntSubsysInfo[nSubSystem].index++;
+	if (cntSubsysInfo[nSubSystem].index >= cntSubsysInfo[nSubSystem].max_count) {
+		cntSubsysInfo[nSubSystem].index = 0;
+	}
+
+	cntSubsysInfo[nSubSystem].tally -= cntSubsysInfo[nSubSystem].count[cntSubsysInfo[nSubSystem].index];
+
+	cntSubsysInfo[nSubSystem].count[cntSubsysInfo[nSubSystem].index] = cntGetTicks() - cntSubsysInfo[nSubSystem].start;
+
+	cntSubsysInfo[nSubSystem].tally += cntSubsysInfo[nSubSystem].count[cntSubsysInfo[nSubSystem].index];
+
+	return 0;
+}
+
+// Use milliseconds when reporting profile information
+double cntProfileReadLast(int nSubSystem)
+{
+	return (double)cntSubsysInfo[nSubSystem].count[cntSubsysInfo[nSubSystem].index] / 1000000.0;
+}
+
+double cntProfileReadAverage(int nSubSystem)
+{
+	return (double)(cntSubsysInfo[nSubSystem].tally / (cntSubsysInfo[nSubSystem].max_count)) / 1000000.0;
+}
+
+static int cntProfileGetSettings(InterfaceInfo* pInfo)
+{
+	TCHAR szString[MAX_PATH] = _T("");
+
+	_sntprintf(szString, MAX_PATH, _T("timer resolution is %.0lfns\n"), (double)cntClock::period::num * 1000000000.0 / cntClock::period::den);
+	IntInfoAddStringModule(pInfo, szString);
+
+	return 0;
+}
+
+struct ProfileDo cntDoPerfCount = { cntExit, cntInit, cntProfileStart, cntProfileEnd, cntProfileReadLast, cntProfileReadAverage, cntProfileGetSettings, _T("steady_clock profiler") };
@@ -1,5 +1,6 @@
 // Video Output - (calls all the Vid Out plugins)
 #include "burner.h"
+#include "burn_profile.h"
 
 #define DEFAULT_IMAGE_WIDTH (304)
 #define DEFAULT_IMAGE_HEIGHT (224)
@@ -419,6 +420,8 @@ INT32 VidReInitialise()
 
 INT32 VidFrame()
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_VIDFRAME);
+
 	if (bVidOkay && bDrvOkay) {
 		return VidDoFrame(0);
 	} else {
@@ -445,6 +448,8 @@ INT32 VidRecalcPal()
 // If bValidate & 1, the video code should use ValidateRect() to validate the rectangle it draws.
 INT32 VidPaint(INT32 bValidate)
 {
+	BURN_PROFILE_ZONE(PRF_ZONE_VIDPAINT);
+
 	if (bVidOkay /* && bDrvOkay */) {
 		return pVidOut[nVidActive]->Paint(bValidate);
 	} else {